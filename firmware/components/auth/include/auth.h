@@ -0,0 +1,79 @@
+#ifndef AUTH_H
+#define AUTH_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Tag authorization.
+// The UIDs allowed to activate the bike (4, 7 or 10 bytes) are stored in
+// NVS and loaded into a sorted table of fixed-size entries at init. A
+// lookup is a binary search; every comparison reads all bytes of both
+// entries, so its time does not depend on where two UIDs differ.
+// The master tag only programs the list: presenting it switches to
+// enroll mode, again to revoke mode, and a third time back to normal.
+// In enroll or revoke mode the next tag is added or removed; the mode
+// also ends after CONFIG_AUTH_PROGRAM_TIMEOUT_S. When no master is
+// stored, the first tag presented becomes the master.
+// On the linux target the list only lives in RAM.
+
+#define AUTH_UID_MAX_LEN     10
+
+typedef enum {
+    AUTH_DENIED = 0,
+    AUTH_GRANTED, 					// In the list: activate
+    AUTH_MASTER_SET, 					// First tag, stored as the master
+    AUTH_ENROLL_MODE, 					// Master tag: the next tag is added
+    AUTH_REVOKE_MODE, 					// Master tag again: the next tag is removed
+    AUTH_PROGRAM_DONE, 					// Master tag a third time, back to normal
+    AUTH_ENROLLED,
+    AUTH_REVOKED,
+    AUTH_FULL, 						// Enroll mode, but the list is full
+} auth_result_t;
+
+typedef enum {
+    AUTH_MODE_NORMAL = 0,
+    AUTH_MODE_ENROLL,
+    AUTH_MODE_REVOKE,
+} auth_mode_t;
+
+// Load the list and the master tag from NVS. Call before anything else;
+// after that every function may be called from any task (the scanner
+// checks tags while the console edits the list).
+// On a load error (e.g. more tags stored than CONFIG_AUTH_MAX_TAGS) the
+// table is empty and nothing is saved: no tag becomes the master, and
+// changes fail with ESP_ERR_INVALID_STATE until auth_clear()
+esp_err_t auth_init(void);
+
+// Decide on a tag and run the master tag flow. Changes are saved to NVS
+// before returning; a plain lookup does not touch flash.
+auth_result_t auth_check(const uint8_t *uid, size_t uid_len);
+
+// Lookup only
+bool auth_is_allowed(const uint8_t *uid, size_t uid_len);
+
+esp_err_t auth_add(const uint8_t *uid, size_t uid_len);
+esp_err_t auth_remove(const uint8_t *uid, size_t uid_len);
+
+// Replace the master tag; NULL forgets it, the next tag becomes the master
+esp_err_t auth_set_master(const uint8_t *uid, size_t uid_len);
+
+// Remove every tag and the master, also after a failed load
+esp_err_t auth_clear(void);
+
+size_t auth_count(void);
+auth_mode_t auth_mode(void);
+
+// Register the "auth" console command (call after the REPL is created)
+esp_err_t auth_register_console_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// AUTH_H
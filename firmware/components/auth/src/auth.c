@@ -0,0 +1,406 @@
+#include "auth.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/semphr.h"
+#include "ebike_hal.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_console.h"
+#include "nvs.h"
+#endif
+
+#define AUTH_PROGRAM_TIMEOUT_US  ((int64_t)CONFIG_AUTH_PROGRAM_TIMEOUT_S * 1000000)
+
+// Length first, then the UID zero-padded: entries sort by length, and a
+// 4-byte UID never matches the start of a 7-byte one
+typedef struct {
+    uint8_t len;
+    uint8_t uid[AUTH_UID_MAX_LEN];
+} auth_entry_t;
+
+_Static_assert(sizeof(auth_entry_t) == 1 + AUTH_UID_MAX_LEN, "auth entries are stored packed");
+
+static auth_entry_t tags[CONFIG_AUTH_MAX_TAGS]; 		// Sorted
+static size_t tag_count;
+static auth_entry_t master; 					// len 0: none yet
+static auth_mode_t mode;
+static int64_t mode_until_us;
+// NVS read back. If not, the table above is incomplete: saving it would
+// overwrite the stored one, and an empty master must not be taken over
+static bool loaded;
+
+// Guards everything above: auth_check() runs on the scanner task while the
+// console edits the table. A mutex, not a spinlock: saves write flash under it
+static SemaphoreHandle_t auth_lock;
+
+#define AUTH_LOCK()    xSemaphoreTake(auth_lock, portMAX_DELAY)
+#define AUTH_UNLOCK()  xSemaphoreGive(auth_lock)
+
+static bool auth_entry_make(auth_entry_t *entry, const uint8_t *uid, size_t uid_len) {
+    if (!uid || (uid_len != 4 && uid_len != 7 && uid_len != 10)) return false;
+
+    memset(entry, 0, sizeof(*entry));
+    entry->len = uid_len;
+    memcpy(entry->uid, uid, uid_len);
+    return true;
+}
+
+// Sign like memcmp(), but every byte is read: the first difference is
+// kept with a mask instead of returning early
+static int auth_entry_cmp(const auth_entry_t *a, const auth_entry_t *b) {
+    const uint8_t *pa = (const uint8_t *)a;
+    const uint8_t *pb = (const uint8_t *)b;
+    int result = 0;
+
+    for (size_t i = 0; i < sizeof(auth_entry_t); i++) {
+        int diff = (int)pa[i] - (int)pb[i];
+        result |= diff & -(result == 0);
+    }
+    return result;
+}
+
+// Index of the first entry not below key. auth_lock held, as for every
+// helper below that touches the table
+static size_t auth_lower_bound(const auth_entry_t *key, bool *found) {
+    size_t lo = 0;
+    size_t hi = tag_count;
+
+    while (lo < hi) {
+        size_t mid = lo + (hi - lo) / 2;
+        if (auth_entry_cmp(&tags[mid], key) < 0) {
+            lo = mid + 1;
+        } else {
+            hi = mid;
+        }
+    }
+    *found = lo < tag_count && auth_entry_cmp(&tags[lo], key) == 0;
+    return lo;
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+
+static esp_err_t auth_load(void) {
+    tag_count = 0;
+    memset(&master, 0, sizeof(master));
+    return ESP_OK;
+}
+
+static esp_err_t auth_save(void) {
+    return loaded ? ESP_OK : ESP_ERR_INVALID_STATE;
+}
+
+#else
+
+#define AUTH_NVS_NAMESPACE   "auth"
+#define AUTH_NVS_KEY_TAGS    "tags"
+#define AUTH_NVS_KEY_MASTER  "master"
+
+static int auth_entry_qsort_cmp(const void *a, const void *b) {
+    return auth_entry_cmp(a, b);
+}
+
+static esp_err_t auth_load(void) {
+    tag_count = 0;
+    memset(&master, 0, sizeof(master));
+
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(AUTH_NVS_NAMESPACE, NVS_READONLY, &nvs);
+    if (ret == ESP_ERR_NVS_NOT_FOUND) return ESP_OK; 		// Nothing stored yet
+    if (ret != ESP_OK) return ret;
+
+    // More tags than CONFIG_AUTH_MAX_TAGS fails with ESP_ERR_NVS_INVALID_LENGTH
+    size_t len = sizeof(tags);
+    ret = nvs_get_blob(nvs, AUTH_NVS_KEY_TAGS, tags, &len);
+    if (ret == ESP_OK && len % sizeof(auth_entry_t) != 0) ret = ESP_ERR_INVALID_SIZE;
+    if (ret == ESP_OK) tag_count = len / sizeof(auth_entry_t);
+    if (ret == ESP_ERR_NVS_NOT_FOUND) ret = ESP_OK;
+
+    if (ret == ESP_OK) {
+        len = sizeof(master);
+        ret = nvs_get_blob(nvs, AUTH_NVS_KEY_MASTER, &master, &len);
+        if (ret == ESP_OK && len != sizeof(master)) ret = ESP_ERR_INVALID_SIZE;
+        if (ret == ESP_ERR_NVS_NOT_FOUND) ret = ESP_OK;
+    }
+    nvs_close(nvs);
+
+    if (ret != ESP_OK) {
+        tag_count = 0;
+        memset(&master, 0, sizeof(master));
+        return ret;
+    }
+
+    // Stored sorted, but a lookup must not depend on it
+    qsort(tags, tag_count, sizeof(auth_entry_t), auth_entry_qsort_cmp);
+    return ESP_OK;
+}
+
+static esp_err_t auth_save(void) {
+    if (!loaded) return ESP_ERR_INVALID_STATE;
+
+    nvs_handle_t nvs;
+    esp_err_t ret = nvs_open(AUTH_NVS_NAMESPACE, NVS_READWRITE, &nvs);
+    if (ret != ESP_OK) return ret;
+
+    if (tag_count) {
+        ret = nvs_set_blob(nvs, AUTH_NVS_KEY_TAGS, tags, tag_count * sizeof(auth_entry_t));
+    } else {
+        ret = nvs_erase_key(nvs, AUTH_NVS_KEY_TAGS);
+        if (ret == ESP_ERR_NVS_NOT_FOUND) ret = ESP_OK;
+    }
+    if (ret == ESP_OK) ret = nvs_set_blob(nvs, AUTH_NVS_KEY_MASTER, &master, sizeof(master));
+    if (ret == ESP_OK) ret = nvs_commit(nvs);
+    nvs_close(nvs);
+    return ret;
+}
+
+#endif 				// CONFIG_IDF_TARGET_LINUX
+
+static esp_err_t auth_insert(const auth_entry_t *key) {
+    bool found;
+    size_t pos = auth_lower_bound(key, &found);
+    if (found) return ESP_OK;
+    if (tag_count == CONFIG_AUTH_MAX_TAGS) return ESP_ERR_NO_MEM;
+
+    memmove(&tags[pos + 1], &tags[pos], (tag_count - pos) * sizeof(auth_entry_t));
+    tags[pos] = *key;
+    tag_count++;
+    return auth_save();
+}
+
+static esp_err_t auth_erase(const auth_entry_t *key) {
+    bool found;
+    size_t pos = auth_lower_bound(key, &found);
+    if (!found) return ESP_ERR_NOT_FOUND;
+
+    tag_count--;
+    memmove(&tags[pos], &tags[pos + 1], (tag_count - pos) * sizeof(auth_entry_t));
+    return auth_save();
+}
+
+static auth_mode_t auth_current_mode(void) {
+    if (mode != AUTH_MODE_NORMAL && hal_time_us() >= mode_until_us) {
+        mode = AUTH_MODE_NORMAL;
+    }
+    return mode;
+}
+
+static auth_result_t auth_decide(const auth_entry_t *key) {
+    if (master.len == 0) {
+        // Not "no master yet", only "none read back"
+        if (!loaded) return AUTH_DENIED;
+        master = *key;
+        if (auth_save() != ESP_OK) {
+            memset(&master, 0, sizeof(master));
+            return AUTH_DENIED;
+        }
+        return AUTH_MASTER_SET;
+    }
+
+    auth_mode_t current = auth_current_mode();
+    if (auth_entry_cmp(key, &master) == 0) {
+        mode_until_us = hal_time_us() + AUTH_PROGRAM_TIMEOUT_US;
+        switch (current) {
+        case AUTH_MODE_NORMAL:
+            mode = AUTH_MODE_ENROLL;
+            return AUTH_ENROLL_MODE;
+        case AUTH_MODE_ENROLL:
+            mode = AUTH_MODE_REVOKE;
+            return AUTH_REVOKE_MODE;
+        default:
+            mode = AUTH_MODE_NORMAL;
+            return AUTH_PROGRAM_DONE;
+        }
+    }
+
+    // One tag per master tap
+    mode = AUTH_MODE_NORMAL;
+    esp_err_t ret;
+    bool found;
+
+    switch (current) {
+    case AUTH_MODE_ENROLL:
+        ret = auth_insert(key);
+        if (ret == ESP_ERR_NO_MEM) return AUTH_FULL;
+        return ret == ESP_OK ? AUTH_ENROLLED : AUTH_DENIED;
+    case AUTH_MODE_REVOKE:
+        return auth_erase(key) == ESP_OK ? AUTH_REVOKED : AUTH_DENIED;
+    default:
+        auth_lower_bound(key, &found);
+        return found ? AUTH_GRANTED : AUTH_DENIED;
+    }
+}
+
+esp_err_t auth_init(void) {
+    if (!auth_lock) {
+        auth_lock = xSemaphoreCreateMutex();
+        if (!auth_lock) return ESP_ERR_NO_MEM;
+    }
+
+    AUTH_LOCK();
+    mode = AUTH_MODE_NORMAL;
+    esp_err_t ret = auth_load();
+    loaded = ret == ESP_OK;
+    AUTH_UNLOCK();
+    return ret;
+}
+
+bool auth_is_allowed(const uint8_t *uid, size_t uid_len) {
+    auth_entry_t key;
+    bool found;
+
+    if (!auth_entry_make(&key, uid, uid_len)) return false;
+    AUTH_LOCK();
+    auth_lower_bound(&key, &found);
+    AUTH_UNLOCK();
+    return found;
+}
+
+esp_err_t auth_add(const uint8_t *uid, size_t uid_len) {
+    auth_entry_t key;
+    if (!auth_entry_make(&key, uid, uid_len)) return ESP_ERR_INVALID_ARG;
+
+    AUTH_LOCK();
+    esp_err_t ret = auth_insert(&key);
+    AUTH_UNLOCK();
+    return ret;
+}
+
+esp_err_t auth_remove(const uint8_t *uid, size_t uid_len) {
+    auth_entry_t key;
+    if (!auth_entry_make(&key, uid, uid_len)) return ESP_ERR_INVALID_ARG;
+
+    AUTH_LOCK();
+    esp_err_t ret = auth_erase(&key);
+    AUTH_UNLOCK();
+    return ret;
+}
+
+esp_err_t auth_set_master(const uint8_t *uid, size_t uid_len) {
+    auth_entry_t key = { 0 };
+    if (uid && !auth_entry_make(&key, uid, uid_len)) return ESP_ERR_INVALID_ARG;
+
+    AUTH_LOCK();
+    master = key;
+    mode = AUTH_MODE_NORMAL;
+    esp_err_t ret = auth_save();
+    AUTH_UNLOCK();
+    return ret;
+}
+
+esp_err_t auth_clear(void) {
+    AUTH_LOCK();
+    // Deliberately overwrites whatever could not be loaded
+    loaded = true;
+    tag_count = 0;
+    memset(&master, 0, sizeof(master));
+    mode = AUTH_MODE_NORMAL;
+    esp_err_t ret = auth_save();
+    AUTH_UNLOCK();
+    return ret;
+}
+
+size_t auth_count(void) {
+    AUTH_LOCK();
+    size_t count = tag_count;
+    AUTH_UNLOCK();
+    return count;
+}
+
+auth_mode_t auth_mode(void) {
+    AUTH_LOCK();
+    auth_mode_t current = auth_current_mode();
+    AUTH_UNLOCK();
+    return current;
+}
+
+auth_result_t auth_check(const uint8_t *uid, size_t uid_len) {
+    auth_entry_t key;
+    if (!auth_entry_make(&key, uid, uid_len)) return AUTH_DENIED;
+
+    AUTH_LOCK();
+    auth_result_t result = auth_decide(&key);
+    AUTH_UNLOCK();
+    return result;
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+
+esp_err_t auth_register_console_cmd(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#else
+
+static void auth_print_entry(const char *name, const auth_entry_t *entry) {
+    printf("%s ", name);
+    for (int i = 0; i < entry->len; i++) {
+        printf("%02x", entry->uid[i]);
+    }
+    printf("\n");
+}
+
+// Hex UID as printed by "auth list"
+static bool auth_parse_uid(const char *hex, uint8_t *uid, size_t *uid_len) {
+    size_t len = strlen(hex);
+    if (len % 2 || len / 2 > AUTH_UID_MAX_LEN) return false;
+
+    for (size_t i = 0; i < len / 2; i++) {
+        char byte[3] = { hex[2 * i], hex[2 * i + 1], 0 };
+        char *end;
+        uid[i] = strtoul(byte, &end, 16);
+        if (*end) return false;
+    }
+    *uid_len = len / 2;
+    return true;
+}
+
+static int auth_cmd(int argc, char **argv) {
+    const char *action = argc > 1 ? argv[1] : "list";
+    uint8_t uid[AUTH_UID_MAX_LEN];
+    size_t uid_len;
+    esp_err_t ret = ESP_OK;
+
+    if (strcmp(action, "list") == 0) {
+        static const char *const modes[] = { "normal", "enroll", "revoke" };
+        AUTH_LOCK();
+        printf("auth: %u/%d tags, %s mode\n", (unsigned)tag_count, CONFIG_AUTH_MAX_TAGS, modes[auth_current_mode()]);
+        if (master.len) auth_print_entry("master", &master);
+        for (size_t i = 0; i < tag_count; i++) {
+            auth_print_entry("tag   ", &tags[i]);
+        }
+        AUTH_UNLOCK();
+    } else if ((strcmp(action, "add") == 0 || strcmp(action, "remove") == 0) && argc > 2) {
+        if (!auth_parse_uid(argv[2], uid, &uid_len)) {
+            printf("UID: 4, 7 or 10 bytes in hex\n");
+            return 1;
+        }
+        ret = action[0] == 'a' ? auth_add(uid, uid_len) : auth_remove(uid, uid_len);
+    } else if (strcmp(action, "forget-master") == 0) {
+        ret = auth_set_master(NULL, 0);
+    } else if (strcmp(action, "clear") == 0) {
+        ret = auth_clear();
+    } else {
+        printf("usage: auth [list|add <uid>|remove <uid>|forget-master|clear]\n");
+        return 1;
+    }
+
+    if (ret != ESP_OK) {
+        printf("auth: %s\n", esp_err_to_name(ret));
+        return 1;
+    }
+    return 0;
+}
+
+esp_err_t auth_register_console_cmd(void) {
+    const esp_console_cmd_t cmd = {
+        .command = "auth",
+        .help = "Tag allowlist: list (default), add/remove <uid hex>, forget-master (the next tag becomes the master), clear",
+        .hint = "[list|add <uid>|remove <uid>|forget-master|clear]",
+        .func = auth_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
+
+#endif 				// CONFIG_IDF_TARGET_LINUX
@@ -0,0 +1,66 @@
+#ifndef MOTOR_CONTROL_H
+#define MOTOR_CONTROL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// System parameters
+#define BATTERY_DIVIDER_RATIO 7.2f
+#define WHEEL_CIRCUMFERENCE   2.1f  // meters
+#define HALL_SENSORS_PER_REV  6
+#define MAX_SPEED_RPM         300   // Maximum expected motor RPM
+#define PEDAL_TIMEOUT_MS      2000  // 2 seconds without pedaling cuts assist
+
+// PID parameters
+#define PID_UPDATE_MS         50
+#define KP                    1.0
+#define KI                    0.1
+#define KD                    0.05
+
+// Per-rider limits and gains. motor_profile_default holds the values
+// above: 30-80% assist, no speed limit, accelerator on.
+typedef struct {
+    uint8_t assist_min; 				// % at the potentiometer's low end
+    uint8_t assist_max; 				// % at its high end
+    uint8_t speed_limit_kmh; 				// No motor output at or above; 0: none
+    bool throttle; 					// Accelerator override enabled
+    double kp, ki, kd;
+} motor_profile_t;
+
+extern const motor_profile_t motor_profile_default;
+
+// Configure DAC, hall/pedal interrupts and the throttle/assist ADC channels
+void motor_control_init(void);
+
+// One control pass: turn signals, blind spots, sensors, PID and DAC output
+void motor_control_tick(void);
+
+// Runs motor_control_tick() every PID_UPDATE_MS
+void motor_control_task(void *pvParameters);
+
+// 0.0-1.0 of full VSP
+void set_motor_output(float output);
+
+float calculate_motor_speed(void);
+
+// Last computed values, for the UI
+float motor_control_speed_kmh(void);
+uint8_t motor_control_assist_level(void);
+
+// Switch to a rider's profile (copied; NULL: defaults). Takes effect at
+// the next tick. Safe from any task, any number of times per tick.
+void motor_control_set_profile(const motor_profile_t *profile);
+
+// Clear PID and sensor state and restore the default profile (used by
+// host tests)
+void motor_control_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// MOTOR_CONTROL_H
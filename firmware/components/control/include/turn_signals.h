@@ -0,0 +1,49 @@
+#ifndef TURN_SIGNALS_H
+#define TURN_SIGNALS_H
+
+#include <stdbool.h>
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define TURN_SIGNAL_TIMEOUT   5000  // 5 seconds turn signal auto-off
+
+// Input levels, as sampled by turn_signals_sample()
+#define TURN_LEVEL_RIGHT     (1 << 0)
+#define TURN_LEVEL_LEFT      (1 << 1)
+#define RCWL_LEVEL_RIGHT     (1 << 2)
+#define RCWL_LEVEL_LEFT      (1 << 3)
+
+typedef enum {
+    TURN_NONE = 0,
+    TURN_RIGHT,
+    TURN_LEFT,
+} turn_state_t;
+
+// Configure turn signal and RCWL inputs and the blind spot LED
+void turn_signals_init(void);
+
+// Read turn signal and RCWL inputs into TURN_LEVEL_* / RCWL_LEVEL_* bits
+uint8_t turn_signals_sample(void);
+
+// One pass over already sampled inputs: latch, timeout and blind spot LED
+void turn_signals_update(int64_t now_us, uint8_t levels);
+
+// Latch turn signal inputs and apply the auto-off timeout
+void check_turn_signals(void);
+
+// Drive the blind spot LED from the RCWL on the side being signalled
+void check_blind_spots(void);
+
+turn_state_t turn_signals_state(void);
+
+// Clear latched state (used by host tests)
+void turn_signals_reset(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// TURN_SIGNALS_H
@@ -0,0 +1,248 @@
+#include "motor_control.h"
+#include <stdint.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ebike_hal.h"
+#include "board_pins.h"
+#include "turn_signals.h"
+#include "trace.h"
+#include "recorder.h"
+#include "supervisor.h"
+
+static float current_speed = 0.0f;
+static uint8_t assistance_level = 0;
+
+// Motor control variables. The ISR state below is read and written under
+// input_lock: hall_period and last_pedal_time are 64-bit, and the tick takes
+// them together with the flags. The recorder records under the same lock,
+// so the stream order matches what the tick saw.
+static portMUX_TYPE input_lock = portMUX_INITIALIZER_UNLOCKED;
+static volatile int64_t last_hall_time = 0;
+static volatile int64_t hall_period = 0;
+static volatile bool hall_updated = false;
+static volatile bool pedaling = false;
+static volatile int64_t last_pedal_time = 0;
+static float pid_integral = 0;
+static float last_error = 0;
+static float target_speed = 0;
+static uint8_t last_dac_value = 0;
+
+#define MOTOR_PROFILE_DEFAULT { \
+    .assist_min = 30, \
+    .assist_max = 80, \
+    .speed_limit_kmh = 0, \
+    .throttle = true, \
+    .kp = KP, \
+    .ki = KI, \
+    .kd = KD, \
+}
+
+const motor_profile_t motor_profile_default = MOTOR_PROFILE_DEFAULT;
+
+// An input like the ISR state: the tick copies it with the snapshot, and a
+// new one is copied in and recorded under input_lock, so a tick never
+// sees half of one and replay applies it between the same two ticks
+static motor_profile_t profile = MOTOR_PROFILE_DEFAULT;
+
+// Hall sensor ISR
+static void HAL_ISR_ATTR hall_isr_handler(void* arg) {
+    TRACE_BEGIN(TRACE_EV_HALL_ISR, (uintptr_t)arg);
+    portENTER_CRITICAL_SAFE(&input_lock);
+    int64_t now = hal_time_us();
+    if (last_hall_time != 0) {
+        hall_period = now - last_hall_time;
+        hall_updated = true;
+    }
+    last_hall_time = now;
+    REC_EDGE((uintptr_t)arg, now);
+    portEXIT_CRITICAL_SAFE(&input_lock);
+    TRACE_END(TRACE_EV_HALL_ISR, (uintptr_t)arg);
+}
+
+// Pedal sensor ISR
+static void HAL_ISR_ATTR pedal_isr_handler(void* arg) {
+    TRACE_BEGIN(TRACE_EV_PEDAL_ISR, 0);
+    portENTER_CRITICAL_SAFE(&input_lock);
+    pedaling = true;
+    last_pedal_time = hal_time_us();
+    REC_EDGE(PEDAL_HALL_PIN, last_pedal_time);
+    portEXIT_CRITICAL_SAFE(&input_lock);
+    TRACE_END(TRACE_EV_PEDAL_ISR, 0);
+}
+
+void motor_control_init(void) {
+    // Configure DAC for motor control
+    hal_aout_enable(DAC_OUTPUT_CHANNEL);
+
+    // Setup GPIO interrupts for hall sensors and pedal
+    hal_dio_config((1ULL << HALL1_PIN) | (1ULL << HALL2_PIN) | (1ULL << HALL3_PIN) | (1ULL << PEDAL_HALL_PIN),
+                   HAL_PIN_INPUT_PULLUP, HAL_EDGE_RISING);
+
+    hal_dio_attach_isr(HALL1_PIN, hall_isr_handler, (void *)(uintptr_t)HALL1_PIN);
+    hal_dio_attach_isr(HALL2_PIN, hall_isr_handler, (void *)(uintptr_t)HALL2_PIN);
+    hal_dio_attach_isr(HALL3_PIN, hall_isr_handler, (void *)(uintptr_t)HALL3_PIN);
+    hal_dio_attach_isr(PEDAL_HALL_PIN, pedal_isr_handler, NULL);
+
+    // Configure ADC for potentiometer and accelerator
+    hal_ain_config(POTENTIOMETER_ADC);  // GPIO26 (potentiometer)
+    hal_ain_config(ACCELERATOR_ADC);    // GPIO34 (accelerator)
+}
+
+void set_motor_output(float output) {
+    // Held off after a missed control deadline until the fault is cleared
+    if (supervisor_tripped()) output = 0;
+
+    // Constrain output to 0-1 range
+    if (output < 0) output = 0;
+    else if (output > 1) output = 1;
+
+    // Convert to 8-bit DAC value (0-255)
+    uint8_t dac_value = (uint8_t)(output * 255);
+    last_dac_value = dac_value;
+    hal_aout_write(DAC_OUTPUT_CHANNEL, dac_value);
+}
+
+static float speed_from_period(int64_t period) {
+    float motor_speed = 0;
+    if (period > 0) {
+        float frequency_hz = 1000000.0f / (float)period;
+        motor_speed = (frequency_hz / HALL_SENSORS_PER_REV) * 60.0f; // RPM
+
+        // RPM to m/s, then km/h for the display and the speed limit
+        current_speed = (motor_speed * WHEEL_CIRCUMFERENCE) / 60.0f * 3.6f;
+    }
+    return motor_speed;
+}
+
+float calculate_motor_speed(void) {
+    portENTER_CRITICAL_SAFE(&input_lock);
+    int64_t period = hall_updated ? hall_period : 0;
+    hall_updated = false;
+    portEXIT_CRITICAL_SAFE(&input_lock);
+    return speed_from_period(period);
+}
+
+static int read_adc(int channel) {
+    TRACE_BEGIN(TRACE_EV_ADC_READ, channel);
+    int value = hal_ain_read(channel);
+    TRACE_END(TRACE_EV_ADC_READ, value);
+    return value;
+}
+
+void motor_control_tick(void) {
+    TRACE_BEGIN(TRACE_EV_CONTROL_TICK, 0);
+
+    // Sample every input first. The ISR state is taken in the same
+    // critical section that records the tick, so a replay sees exactly
+    // the edges this pass saw. The section exists with the recorder
+    // compiled out too.
+    uint8_t levels = turn_signals_sample();
+    int pot_value = read_adc(POTENTIOMETER_ADC);
+    int accel_value = read_adc(ACCELERATOR_ADC);
+
+    portENTER_CRITICAL_SAFE(&input_lock);
+    int64_t now = hal_time_us();
+    int64_t period = hall_updated ? hall_period : 0;
+    hall_updated = false;
+    bool pedal_edge = pedaling;
+    pedaling = false;
+    int64_t pedal_time = last_pedal_time;
+    const motor_profile_t p = profile;
+    REC_TICK(now, pot_value, accel_value, levels);
+    portEXIT_CRITICAL_SAFE(&input_lock);
+
+    // Check turn signals and blind spots
+    turn_signals_update(now, levels);
+
+    float current_speed_rpm = speed_from_period(period);
+
+    // Calculate assistance level (30-80% by default)
+    assistance_level = p.assist_min + (pot_value * (p.assist_max - p.assist_min)) / 4095;
+
+    // Check if pedaling recently
+    bool active_pedaling = (now - pedal_time) < (PEDAL_TIMEOUT_MS * 1000);
+
+    // Calculate motor output
+    float motor_output = 0;
+
+    // Direct accelerator override
+    float accelerator = (float)accel_value / 4095.0f;
+    if (p.throttle && accelerator > 0.1f) {
+        motor_output = accelerator;
+        pid_integral = 0; // Reset PID on direct accelerator use
+    }
+    // PID control when pedaling
+    else if (active_pedaling && pedal_edge) {
+        target_speed = (MAX_SPEED_RPM * assistance_level) / 100.0f;
+        float error = target_speed - current_speed_rpm;
+
+        // PID calculation
+        pid_integral += error * (PID_UPDATE_MS / 1000.0f);
+        float derivative = (error - last_error) / (PID_UPDATE_MS / 1000.0f);
+
+        motor_output = p.kp * error + p.ki * pid_integral + p.kd * derivative;
+        motor_output = motor_output / MAX_SPEED_RPM; // Normalize
+
+        last_error = error;
+    }
+
+    // Speed limit: no assist or accelerator above it
+    if (p.speed_limit_kmh && current_speed >= p.speed_limit_kmh) {
+        motor_output = 0;
+    }
+
+    // Apply motor output
+    set_motor_output(motor_output);
+    supervisor_feed();
+
+    TRACE_END(TRACE_EV_CONTROL_TICK, last_dac_value);
+}
+
+void motor_control_task(void *pvParameters) {
+    supervisor_attach_task();
+    while (1) {
+        motor_control_tick();
+        vTaskDelay(pdMS_TO_TICKS(PID_UPDATE_MS));
+    }
+}
+
+float motor_control_speed_kmh(void) {
+    return current_speed;
+}
+
+uint8_t motor_control_assist_level(void) {
+    return assistance_level;
+}
+
+void motor_control_set_profile(const motor_profile_t *next) {
+    if (!next) next = &motor_profile_default;
+    portENTER_CRITICAL_SAFE(&input_lock);
+    profile = *next;
+    REC_PROFILE(&((rec_profile_t){
+        .assist_min = next->assist_min,
+        .assist_max = next->assist_max,
+        .speed_limit_kmh = next->speed_limit_kmh,
+        .throttle = next->throttle,
+        .kp = next->kp,
+        .ki = next->ki,
+        .kd = next->kd,
+    }), hal_time_us());
+    portEXIT_CRITICAL_SAFE(&input_lock);
+}
+
+void motor_control_reset(void) {
+    motor_control_set_profile(NULL);
+    current_speed = 0.0f;
+    assistance_level = 0;
+    portENTER_CRITICAL_SAFE(&input_lock);
+    last_hall_time = 0;
+    hall_period = 0;
+    hall_updated = false;
+    pedaling = false;
+    last_pedal_time = 0;
+    portEXIT_CRITICAL_SAFE(&input_lock);
+    pid_integral = 0;
+    last_error = 0;
+    target_speed = 0;
+    last_dac_value = 0;
+}
@@ -0,0 +1,93 @@
+#include "turn_signals.h"
+#include <stdint.h>
+#include "ebike_hal.h"
+#include "board_pins.h"
+#include "dlog.h"
+
+static bool right_turn_active = false;
+static bool left_turn_active = false;
+static int64_t turn_signal_start_time = 0;
+
+void turn_signals_init(void) {
+    hal_dio_config((1ULL << TURN_SIGNAL_RIGHT) | (1ULL << TURN_SIGNAL_LEFT) |
+                   (1ULL << RCWL_RIGHT_GPIO) | (1ULL << RCWL_LEFT_GPIO),
+                   HAL_PIN_INPUT, HAL_EDGE_NONE);
+    hal_dio_config(1ULL << BLIND_SPOT_LED_GPIO, HAL_PIN_OUTPUT, HAL_EDGE_NONE);
+}
+
+uint8_t turn_signals_sample(void) {
+    uint8_t levels = 0;
+    if (hal_dio_read(TURN_SIGNAL_RIGHT)) levels |= TURN_LEVEL_RIGHT;
+    if (hal_dio_read(TURN_SIGNAL_LEFT)) levels |= TURN_LEVEL_LEFT;
+    if (hal_dio_read(RCWL_RIGHT_GPIO)) levels |= RCWL_LEVEL_RIGHT;
+    if (hal_dio_read(RCWL_LEFT_GPIO)) levels |= RCWL_LEVEL_LEFT;
+    return levels;
+}
+
+static void latch_turn_signals(int64_t now, uint8_t levels) {
+    // Check if turn signals are active
+    bool right_signal = levels & TURN_LEVEL_RIGHT;
+    bool left_signal = levels & TURN_LEVEL_LEFT;
+    
+    // Update turn signal states
+    if (right_signal && !right_turn_active) {
+        right_turn_active = true;
+        left_turn_active = false;
+        turn_signal_start_time = now;
+    } 
+    else if (left_signal && !left_turn_active) {
+        left_turn_active = true;
+        right_turn_active = false;
+        turn_signal_start_time = now;
+    }
+    
+    // Auto-turn-off after timeout
+    if ((right_turn_active || left_turn_active) && 
+        (now - turn_signal_start_time) > (TURN_SIGNAL_TIMEOUT * 1000)) {
+        right_turn_active = false;
+        left_turn_active = false;
+    }
+}
+
+static void drive_blind_spot_led(uint8_t levels) {
+    bool blind_spot_detected = false;
+    
+    // Right blind spot check (only if right turn signal is active)
+    if (right_turn_active && (levels & RCWL_LEVEL_RIGHT)) {
+        blind_spot_detected = true;
+        DLOGI(BLIND_SPOT_RIGHT);
+    }
+    // Left blind spot check (only if left turn signal is active)
+    else if (left_turn_active && (levels & RCWL_LEVEL_LEFT)) {
+        blind_spot_detected = true;
+        DLOGI(BLIND_SPOT_LEFT);
+    }
+    
+    // Control blind spot warning LED
+    hal_dio_write(BLIND_SPOT_LED_GPIO, blind_spot_detected);
+}
+
+void turn_signals_update(int64_t now_us, uint8_t levels) {
+    latch_turn_signals(now_us, levels);
+    drive_blind_spot_led(levels);
+}
+
+void check_turn_signals(void) {
+    latch_turn_signals(hal_time_us(), turn_signals_sample());
+}
+
+void check_blind_spots(void) {
+    drive_blind_spot_led(turn_signals_sample());
+}
+
+turn_state_t turn_signals_state(void) {
+    if (right_turn_active) return TURN_RIGHT;
+    if (left_turn_active) return TURN_LEFT;
+    return TURN_NONE;
+}
+
+void turn_signals_reset(void) {
+    right_turn_active = false;
+    left_turn_active = false;
+    turn_signal_start_time = 0;
+}
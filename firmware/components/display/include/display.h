@@ -0,0 +1,62 @@
+#ifndef DISPLAY_H
+#define DISPLAY_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "turn_signals.h"
+#include "lcd_nokia5110.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Values shown on the riding screen
+typedef struct {
+    float battery_voltage;
+    float speed_kmh;
+    uint8_t assist_level; 				// %
+    turn_state_t turn;
+} display_status_t;
+
+// Reset the PCD8544, bring up its SPI bus and clear the screen. On an
+// error the bike runs without a display: every call below is a no-op.
+esp_err_t display_init(void);
+
+// Idle screen shown until a tag is scanned
+void display_show_waiting(void);
+
+// Redraw the riding screen into the framebuffer and flush it
+void display_update(const display_status_t *status);
+
+// Call while waiting for a tag instead of display_update(). Powers the
+// panel down after CONFIG_DISPLAY_SLEEP_S; the next screen wakes it.
+void display_idle(void);
+
+// Time until the next display_update() or display_idle(), from the
+// refresh governor: short while speed or alerts change fast, a slow
+// heartbeat when the screen is stable
+uint32_t display_refresh_ms(void);
+
+// Refresh rate and bus load, measured since the previous call
+typedef struct {
+    float fps; 						// display_update() calls per second
+    float flush_fps; 					// Frames that reached the bus per second
+    float bus_load; 					// Share of time the bus was busy, 0-1
+    uint32_t period_ms; 				// Current refresh period
+    bool asleep; 					// Panel powered down
+} display_rate_t;
+void display_get_rate(display_rate_t *rate);
+
+// SPI traffic and flush time of the LCD
+void display_get_stats(lcd_nokia5110_stats_t *stats);
+void display_clear_stats(void);
+
+// "disp" console command
+esp_err_t display_register_console_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// DISPLAY_H
@@ -0,0 +1,41 @@
+#ifndef DISPLAY_GOVERNOR_H
+#define DISPLAY_GOVERNOR_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Refresh period governor. Each frame reports how much changed on
+// screen and the governor returns the time until the next frame: the
+// fast period right after a big change (speed jump, new alert), at most
+// the normal period while values drift, and a period that doubles up to
+// the slow heartbeat while nothing changes.
+
+typedef enum {
+    DISPLAY_ACTIVITY_NONE, 				// Nothing redrawn
+    DISPLAY_ACTIVITY_MINOR, 				// Some value redrawn
+    DISPLAY_ACTIVITY_MAJOR, 				// Fast change or alert
+} display_activity_t;
+
+typedef struct {
+    uint32_t fast_ms;
+    uint32_t normal_ms;
+    uint32_t slow_ms;
+    uint32_t period_ms; 				// Current period
+} display_governor_t;
+
+// Start at the normal period
+void display_governor_reset(display_governor_t *gov);
+
+// Period until the next frame, never below min_ms (what the panel can
+// take) and never above max_ms (e.g. half a blink period)
+uint32_t display_governor_frame(display_governor_t *gov, display_activity_t activity,
+                                uint32_t min_ms, uint32_t max_ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// DISPLAY_GOVERNOR_H
@@ -0,0 +1,74 @@
+#ifndef DISPLAY_WIDGETS_H
+#define DISPLAY_WIDGETS_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "lcd_nokia5110.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Retained-mode dashboard widgets. Each widget remembers what it drew
+// last and only redraws its own box when that changes, so a frame where
+// no value changed leaves the framebuffer, and so the bus, untouched.
+// Static labels are drawn once when a screen is entered. Clearing
+// `drawn` (or zero-initializing the widget) forces the next set to draw.
+// The set functions return true if they drew anything.
+
+// Static text at pixel column x of bank row
+typedef struct {
+    uint8_t x;
+    uint8_t row;
+    const char *text;
+} display_label_t;
+
+// Fixed-point number, right aligned in width characters of font (NULL
+// for the 5x7 font); row is the top bank
+typedef struct {
+    uint8_t x;
+    uint8_t row;
+    uint8_t decimals;
+    uint8_t width;
+    const font_digits_t *font;
+    int32_t value; 					// Last drawn
+    bool drawn;
+} display_number_t;
+
+// Horizontal bar in a 1 px outline, filled left to right from min to max
+typedef struct {
+    uint8_t x, y, w, h; 				// Outline box, pixels
+    int32_t min;
+    int32_t max;
+    uint8_t fill; 					// Filled columns last drawn
+    bool drawn;
+} display_bar_t;
+
+// Bitmap (framebuffer layout, see lcd_nokia5110_draw_bitmap) in a fixed
+// w x h box; a NULL bitmap blanks the box
+typedef struct {
+    uint8_t x, y, w, h;
+    const uint8_t *bitmap; 				// Last drawn
+    bool drawn;
+} display_icon_t;
+
+// Icon that blinks while a bitmap is set, on first for half a period
+typedef struct {
+    display_icon_t icon;
+    uint32_t period_ms;
+    const uint8_t *bitmap; 				// Current indication
+    int64_t since_us; 					// When it was set
+} display_blink_t;
+
+void display_labels_draw(lcd_nokia5110_t lcd, const display_label_t *labels, size_t count);
+bool display_number_set(lcd_nokia5110_t lcd, display_number_t *number, int32_t value);
+bool display_bar_set(lcd_nokia5110_t lcd, display_bar_t *bar, int32_t value);
+bool display_icon_set(lcd_nokia5110_t lcd, display_icon_t *icon, const uint8_t *bitmap);
+bool display_blink_set(lcd_nokia5110_t lcd, display_blink_t *blink, const uint8_t *bitmap, int64_t now_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// DISPLAY_WIDGETS_H
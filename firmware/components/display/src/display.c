@@ -0,0 +1,273 @@
+#include "display.h"
+#include <string.h>
+#include "sdkconfig.h"
+#include "board_pins.h"
+#include "ebike_hal.h"
+#include "display_widgets.h"
+#include "display_governor.h"
+#include "trace.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include <stdio.h>
+#include "esp_console.h"
+#endif
+
+#define DISPLAY_CONTRAST     0x3F
+#define DISPLAY_COLS         14 				// 6 px per character
+#define DISPLAY_BLINK_MS     1000 				// Turn indicator period
+#define DISPLAY_BATT_EMPTY_DV 300 				// Battery bar range, 0.1 V
+#define DISPLAY_BATT_FULL_DV 420
+#define DISPLAY_FAST_SPEED_DT 5 				// 0.5 km/h between frames is a fast change
+
+static lcd_nokia5110_t lcd; 					// NULL when the panel failed to init
+static bool riding_screen;
+
+static display_governor_t governor = {
+    .fast_ms = CONFIG_DISPLAY_FAST_MS,
+    .normal_ms = CONFIG_DISPLAY_NORMAL_MS,
+    .slow_ms = CONFIG_DISPLAY_SLOW_MS,
+};
+static turn_state_t last_turn;
+static int64_t waiting_since_us;
+static bool asleep;
+
+// Counters at the previous display_get_rate()
+static struct {
+    int64_t time_us;
+    uint32_t frames;
+    uint32_t flushes;
+    uint32_t busy_us;
+} rate_mark;
+
+// Print one line of text at the start of a bank, padded over the whole
+// bank so the previous text is overwritten instead of cleared first.
+// Only glyph columns that actually change end up dirty.
+static void lcd_print_line(uint8_t row, const char *str) {
+    lcd_nokia5110_set_cursor(lcd, 0, row);
+    lcd_nokia5110_write_string(lcd, str);
+    for (size_t n = strlen(str); n < DISPLAY_COLS; n++) {
+        lcd_nokia5110_write_char(lcd, ' ');
+    }
+}
+
+// Riding screen: labels are drawn once when the screen is entered, the
+// widgets only redraw when their value changes
+static const display_label_t riding_labels[] = {
+    { 0, 0, "Batt:" },
+    { 60, 0, "V" },
+    { 54, 2, "km/h" }, 					// Next to the bottom of the speed
+    { 0, 3, "Assist:" },
+    { 60, 3, "%" },
+};
+
+// "->" and "<-" in the 5x7 font
+static const uint8_t arrow_right[12] = { 0x08, 0x08, 0x08, 0x08, 0x08, 0x00, 0x41, 0x22, 0x14, 0x08, 0x00, 0x00 };
+static const uint8_t arrow_left[12] = { 0x00, 0x08, 0x14, 0x22, 0x41, 0x00, 0x08, 0x08, 0x08, 0x08, 0x08, 0x00 };
+
+static display_number_t battery = { .x = 30, .row = 0, .decimals = 1, .width = 5 };
+static display_number_t speed = { .x = 0, .row = 1, .decimals = 1, .width = 4, .font = &font_digits_2x };
+static display_number_t assist = { .x = 42, .row = 3, .decimals = 0, .width = 3 };
+static display_blink_t turn = { .icon = { .x = 72, .y = 24, .w = 12, .h = 8 }, .period_ms = DISPLAY_BLINK_MS };
+static display_bar_t battery_bar = {
+    .x = 0, .y = 40, .w = 84, .h = 8,
+    .min = DISPLAY_BATT_EMPTY_DV, .max = DISPLAY_BATT_FULL_DV,
+};
+
+static void riding_enter(void) {
+    lcd_nokia5110_clear(lcd);
+    display_labels_draw(lcd, riding_labels, sizeof(riding_labels) / sizeof(riding_labels[0]));
+    battery.drawn = false;
+    speed.drawn = false;
+    assist.drawn = false;
+    turn.icon.drawn = false;
+    turn.bitmap = NULL;
+    battery_bar.drawn = false;
+    last_turn = TURN_NONE;
+    display_governor_reset(&governor);
+    riding_screen = true;
+}
+
+static void wake(void) {
+    if (asleep) {
+        lcd_nokia5110_sleep(lcd, false);
+        asleep = false;
+    }
+}
+
+// Float to tenths, rounded half away from zero
+static int32_t to_tenths(float value) {
+    return (int32_t)(value * 10.0f + (value < 0 ? -0.5f : 0.5f));
+}
+
+esp_err_t display_init(void) {
+    // Re-init (host tests) starts from a fresh driver instance
+    if (lcd) {
+        lcd_nokia5110_deinit(lcd);
+        lcd = NULL;
+    }
+    riding_screen = false;
+    asleep = false;
+    display_governor_reset(&governor);
+
+#if CONFIG_DISPLAY_PANEL_SSD1306
+    lcd_nokia5110_config_t config = {
+        .panel = LCD_NOKIA5110_PANEL_SSD1306,
+        .i2c_port = DISPLAY_I2C_PORT,
+        .pin_sda = DISPLAY_SDA_PIN,
+        .pin_scl = DISPLAY_SCL_PIN,
+        .i2c_addr = CONFIG_DISPLAY_SSD1306_ADDR,
+        .height = CONFIG_DISPLAY_SSD1306_HEIGHT,
+        .clock_hz = CONFIG_DISPLAY_SSD1306_I2C_HZ,
+        .contrast = DISPLAY_CONTRAST,
+    };
+#else
+    lcd_nokia5110_config_t config = {
+        .pin_sclk = DISPLAY_CLK_PIN,
+        .pin_din = DISPLAY_DIN_PIN,
+        .pin_dc = DISPLAY_DC_PIN,
+        .pin_cs = DISPLAY_CE_PIN,
+        .pin_rst = DISPLAY_RST_PIN,
+        .spi_host = DISPLAY_SPI_HOST,
+        .bus_priority = DISPLAY_SPI_PRIORITY,
+        .contrast = DISPLAY_CONTRAST,
+    };
+#endif
+    rate_mark.time_us = hal_time_us();
+    rate_mark.frames = 0;
+    rate_mark.flushes = 0;
+    rate_mark.busy_us = 0;
+
+    esp_err_t ret = lcd_nokia5110_init(&config, &lcd);
+    if (ret != ESP_OK) lcd = NULL;
+    return ret;
+}
+
+void display_show_waiting(void) {
+    if (!lcd) return;
+    wake();
+    waiting_since_us = hal_time_us();
+    riding_screen = false;
+    lcd_nokia5110_clear(lcd);
+    lcd_print_line(0, "Waiting for");
+    lcd_print_line(1, "RFID tag");
+    lcd_print_line(3, "Scan to");
+    lcd_print_line(4, "activate");
+    lcd_nokia5110_update(lcd);
+}
+
+void display_update(const display_status_t *status) {
+    if (!lcd) return;
+    TRACE_BEGIN(TRACE_EV_DISPLAY_FLUSH, 0);
+    wake();
+    if (!riding_screen) {
+        riding_enter();
+    }
+
+    int32_t battery_dv = to_tenths(status->battery_voltage);
+    int32_t speed_dt = to_tenths(status->speed_kmh);
+    bool speed_jump = speed.drawn && (speed_dt - speed.value >= DISPLAY_FAST_SPEED_DT
+                                      || speed.value - speed_dt >= DISPLAY_FAST_SPEED_DT);
+    bool changed = display_number_set(lcd, &battery, battery_dv);
+    changed |= display_bar_set(lcd, &battery_bar, battery_dv);
+    changed |= display_number_set(lcd, &speed, speed_dt);
+    changed |= display_number_set(lcd, &assist, status->assist_level);
+
+    const uint8_t *arrow = status->turn == TURN_RIGHT ? arrow_right
+                         : status->turn == TURN_LEFT ? arrow_left : NULL;
+    changed |= display_blink_set(lcd, &turn, arrow, hal_time_us());
+
+    lcd_nokia5110_update(lcd);
+
+    // The blink has to be sampled at least twice per period, and the
+    // panel cannot refresh faster than it flushes
+    display_activity_t activity = speed_jump || status->turn != last_turn ? DISPLAY_ACTIVITY_MAJOR
+                                : changed ? DISPLAY_ACTIVITY_MINOR : DISPLAY_ACTIVITY_NONE;
+    last_turn = status->turn;
+    lcd_nokia5110_stats_t stats;
+    lcd_nokia5110_get_stats(lcd, &stats);
+    display_governor_frame(&governor, activity, (stats.last_flush_us + 999) / 1000,
+                           arrow ? DISPLAY_BLINK_MS / 2 : UINT32_MAX);
+    TRACE_END(TRACE_EV_DISPLAY_FLUSH, 0);
+}
+
+void display_idle(void) {
+    if (!lcd || riding_screen || asleep || !CONFIG_DISPLAY_SLEEP_S) return;
+    if (hal_time_us() - waiting_since_us >= (int64_t)CONFIG_DISPLAY_SLEEP_S * 1000000) {
+        lcd_nokia5110_sleep(lcd, true);
+        asleep = true;
+    }
+}
+
+uint32_t display_refresh_ms(void) {
+    return riding_screen ? governor.period_ms : CONFIG_DISPLAY_SLOW_MS;
+}
+
+void display_get_rate(display_rate_t *rate) {
+    lcd_nokia5110_stats_t stats;
+    display_get_stats(&stats);
+    int64_t now = hal_time_us();
+    float elapsed_s = (float)(now - rate_mark.time_us) / 1e6f;
+
+    rate->fps = 0;
+    rate->flush_fps = 0;
+    rate->bus_load = 0;
+    if (elapsed_s > 0) {
+        rate->fps = (float)(stats.frames - rate_mark.frames) / elapsed_s;
+        rate->flush_fps = (float)(stats.flushes - rate_mark.flushes) / elapsed_s;
+        rate->bus_load = (float)(stats.busy_us - rate_mark.busy_us) / 1e6f / elapsed_s;
+    }
+    rate->period_ms = display_refresh_ms();
+    rate->asleep = asleep;
+
+    rate_mark.time_us = now;
+    rate_mark.frames = stats.frames;
+    rate_mark.flushes = stats.flushes;
+    rate_mark.busy_us = stats.busy_us;
+}
+
+void display_get_stats(lcd_nokia5110_stats_t *stats) {
+    if (lcd) {
+        lcd_nokia5110_get_stats(lcd, stats);
+    } else {
+        memset(stats, 0, sizeof(*stats));
+    }
+}
+
+void display_clear_stats(void) {
+    if (lcd) lcd_nokia5110_clear_stats(lcd);
+    rate_mark.frames = 0;
+    rate_mark.flushes = 0;
+    rate_mark.busy_us = 0;
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+
+esp_err_t display_register_console_cmd(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#else
+
+static int disp_cmd(int argc, char **argv) {
+    display_rate_t rate;
+    lcd_nokia5110_stats_t stats;
+    display_get_rate(&rate);
+    display_get_stats(&stats);
+    printf("display: %s, period %lu ms, %.1f fps, %.1f flushes/s, bus %.2f%%\n",
+           rate.asleep ? "asleep" : "on", (unsigned long)rate.period_ms,
+           rate.fps, rate.flush_fps, rate.bus_load * 100.0f);
+    printf("         %lu frames, %lu flushes, %lu transactions, %lu bytes, flush %lu us (max %lu)\n",
+           (unsigned long)stats.frames, (unsigned long)stats.flushes, (unsigned long)stats.transactions,
+           (unsigned long)stats.bytes, (unsigned long)stats.last_flush_us, (unsigned long)stats.max_flush_us);
+    return 0;
+}
+
+esp_err_t display_register_console_cmd(void) {
+    const esp_console_cmd_t cmd = {
+        .command = "disp",
+        .help = "Display refresh rate and bus load since the last call, and the LCD bus counters",
+        .func = disp_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
+
+#endif 				// CONFIG_IDF_TARGET_LINUX
@@ -0,0 +1,28 @@
+#include "display_governor.h"
+
+void display_governor_reset(display_governor_t *gov) {
+    gov->period_ms = gov->normal_ms;
+}
+
+uint32_t display_governor_frame(display_governor_t *gov, display_activity_t activity,
+                                uint32_t min_ms, uint32_t max_ms) {
+    uint32_t period = gov->period_ms;
+
+    switch (activity) {
+    case DISPLAY_ACTIVITY_MAJOR:
+        period = gov->fast_ms;
+        break;
+    case DISPLAY_ACTIVITY_MINOR:
+        // Back off from a burst, or come back from the heartbeat at once
+        period = period * 2 < gov->normal_ms ? period * 2 : gov->normal_ms;
+        break;
+    default:
+        period = period * 2 < gov->slow_ms ? period * 2 : gov->slow_ms;
+        break;
+    }
+
+    if (period > max_ms) period = max_ms;
+    if (period < min_ms) period = min_ms;
+    gov->period_ms = period;
+    return period;
+}
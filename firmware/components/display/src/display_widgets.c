@@ -0,0 +1,75 @@
+#include "display_widgets.h"
+
+void display_labels_draw(lcd_nokia5110_t lcd, const display_label_t *labels, size_t count) {
+    for (size_t i = 0; i < count; i++) {
+        lcd_nokia5110_set_cursor(lcd, labels[i].x, labels[i].row);
+        lcd_nokia5110_write_string(lcd, labels[i].text);
+    }
+}
+
+bool display_number_set(lcd_nokia5110_t lcd, display_number_t *number, int32_t value) {
+    if (number->drawn && number->value == value) return false;
+
+    lcd_nokia5110_set_cursor(lcd, number->x, number->row);
+    lcd_nokia5110_write_fixed_font(lcd, number->font ? number->font : &font_digits_1x, value,
+                                   number->decimals, number->width, 0);
+    number->value = value;
+    number->drawn = true;
+    return true;
+}
+
+bool display_bar_set(lcd_nokia5110_t lcd, display_bar_t *bar, int32_t value) {
+    uint8_t inner_w = bar->w - 2;
+    uint8_t inner_h = bar->h - 2;
+
+    if (value < bar->min) value = bar->min;
+    if (value > bar->max) value = bar->max;
+    uint8_t fill = bar->max > bar->min
+                 ? (uint8_t)((int64_t)(value - bar->min) * inner_w / (bar->max - bar->min)) : 0;
+
+    if (!bar->drawn) {
+        lcd_nokia5110_draw_rect(lcd, bar->x, bar->y, bar->w, bar->h, false, true);
+        lcd_nokia5110_draw_rect(lcd, bar->x + 1, bar->y + 1, inner_w, inner_h, true, false);
+        bar->fill = 0;
+        bar->drawn = true;
+    } else if (fill == bar->fill) {
+        return false;
+    }
+
+    // Only the columns between the old and the new level
+    if (fill > bar->fill) {
+        lcd_nokia5110_draw_rect(lcd, bar->x + 1 + bar->fill, bar->y + 1, fill - bar->fill, inner_h, true, true);
+    } else if (fill < bar->fill) {
+        lcd_nokia5110_draw_rect(lcd, bar->x + 1 + fill, bar->y + 1, bar->fill - fill, inner_h, true, false);
+    }
+    bar->fill = fill;
+    return true;
+}
+
+bool display_icon_set(lcd_nokia5110_t lcd, display_icon_t *icon, const uint8_t *bitmap) {
+    if (icon->drawn && icon->bitmap == bitmap) return false;
+
+    if (bitmap) {
+        lcd_nokia5110_draw_bitmap(lcd, icon->x, icon->y, bitmap, icon->w, icon->h);
+    } else {
+        lcd_nokia5110_draw_rect(lcd, icon->x, icon->y, icon->w, icon->h, true, false);
+    }
+    icon->bitmap = bitmap;
+    icon->drawn = true;
+    return true;
+}
+
+bool display_blink_set(lcd_nokia5110_t lcd, display_blink_t *blink, const uint8_t *bitmap, int64_t now_us) {
+    // A new indication restarts the phase, so it shows right away
+    if (bitmap != blink->bitmap) {
+        blink->bitmap = bitmap;
+        blink->since_us = now_us;
+    }
+
+    bool on = false;
+    if (bitmap) {
+        int64_t half_us = (int64_t)blink->period_ms * 500;
+        on = half_us <= 0 || ((now_us - blink->since_us) / half_us) % 2 == 0;
+    }
+    return display_icon_set(lcd, &blink->icon, on ? bitmap : NULL);
+}
@@ -0,0 +1,68 @@
+#ifndef DLOG_H
+#define DLOG_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <string.h>
+#include "esp_err.h"
+#include "esp_log.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Deferred logger.
+// Hot paths only enqueue a format ID plus raw 32-bit arguments into a
+// lock-free ring; a low priority task drains it to the UART. Formatting
+// happens either in that task or on the host (tools/dlog_decode.py).
+
+#define DLOG_MAX_ARGS        4
+
+// Format IDs generated from dlog_formats.def
+typedef enum {
+#define DLOG_FORMAT(id, tag, fmt) DLOG_FMT_##id,
+#include "dlog_formats.def"
+#undef DLOG_FORMAT
+    DLOG_FMT_MAX
+} dlog_format_t;
+
+// Enqueue one message. Safe from tasks and ISRs on both cores, never blocks.
+// Returns false (and counts a drop) when the ring is full.
+bool dlog_write(esp_log_level_t level, dlog_format_t fmt, uint8_t nargs, const uint32_t *args);
+
+// Pass a float argument (matched with %f/%e/%g in the format)
+static inline uint32_t DLOG_F(float value) {
+    uint32_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    return bits;
+}
+
+#define DLOG_ARGS_(...)      ((const uint32_t[]){ 0, ##__VA_ARGS__ })
+#define DLOG_NARGS_(...)     (sizeof(DLOG_ARGS_(__VA_ARGS__)) / sizeof(uint32_t) - 1)
+
+#define DLOG(level, id, ...)                                                   \
+    do {                                                                       \
+        _Static_assert(DLOG_NARGS_(__VA_ARGS__) <= DLOG_MAX_ARGS, "too many dlog arguments"); \
+        dlog_write((level), DLOG_FMT_##id, DLOG_NARGS_(__VA_ARGS__),           \
+                   DLOG_ARGS_(__VA_ARGS__) + 1);                               \
+    } while (0)
+
+#define DLOGE(id, ...)       DLOG(ESP_LOG_ERROR, id, ##__VA_ARGS__)
+#define DLOGW(id, ...)       DLOG(ESP_LOG_WARN, id, ##__VA_ARGS__)
+#define DLOGI(id, ...)       DLOG(ESP_LOG_INFO, id, ##__VA_ARGS__)
+#define DLOGD(id, ...)       DLOG(ESP_LOG_DEBUG, id, ##__VA_ARGS__)
+
+// Start the drain task
+esp_err_t dlog_init(void);
+
+// Drain everything queued so far from the calling task (e.g. before a reset)
+void dlog_flush(void);
+
+// Number of messages dropped because the ring was full
+uint32_t dlog_dropped(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// DLOG_H
@@ -0,0 +1,225 @@
+#include "dlog.h"
+#include <stdio.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_attr.h"
+#include "ebike_hal.h"
+
+#define DLOG_RING_SIZE       CONFIG_DLOG_RING_SIZE
+#define DLOG_RING_MASK       (DLOG_RING_SIZE - 1)
+#define DLOG_DRAIN_PERIOD_MS 20
+
+_Static_assert((DLOG_RING_SIZE & DLOG_RING_MASK) == 0, "CONFIG_DLOG_RING_SIZE must be a power of two");
+
+// One queued message. seq implements a bounded MPSC queue (Vyukov style):
+// seq == pos means free for the producer at pos, seq == pos + 1 means
+// ready for the consumer. It is stored minus the slot index so the
+// zero-initialized ring is already valid and messages logged before
+// dlog_init() are kept.
+typedef struct {
+    uint32_t seq;
+    uint32_t timestamp_us; 					// Low 32 bits of hal_time_us()
+    uint8_t fmt; 						// dlog_format_t
+    uint8_t level; 						// esp_log_level_t
+    uint8_t nargs;
+    uint32_t args[DLOG_MAX_ARGS];
+} dlog_slot_t;
+
+static dlog_slot_t dlog_ring[DLOG_RING_SIZE];
+static uint32_t dlog_enqueue_pos;
+static uint32_t dlog_dequeue_pos; 				// Only touched by the consumer
+static uint32_t dlog_drop_count;
+static TaskHandle_t dlog_task_handle;
+static SemaphoreHandle_t dlog_consumer_lock;
+
+static const char dlog_level_chars[] = { 'N', 'E', 'W', 'I', 'D', 'V' };
+
+#if CONFIG_DLOG_OUTPUT_TEXT
+typedef struct {
+    const char *tag;
+    const char *fmt;
+} dlog_format_entry_t;
+
+static const dlog_format_entry_t dlog_formats[DLOG_FMT_MAX] = {
+#define DLOG_FORMAT(id, tag, fmt) [DLOG_FMT_##id] = { tag, fmt },
+#include "dlog_formats.def"
+#undef DLOG_FORMAT
+};
+#endif
+
+bool IRAM_ATTR dlog_write(esp_log_level_t level, dlog_format_t fmt, uint8_t nargs, const uint32_t *args) {
+    uint32_t pos = __atomic_load_n(&dlog_enqueue_pos, __ATOMIC_RELAXED);
+    dlog_slot_t *slot;
+
+    for (;;) {
+        slot = &dlog_ring[pos & DLOG_RING_MASK];
+        uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) + (pos & DLOG_RING_MASK);
+        int32_t diff = (int32_t)(seq - pos);
+
+        if (diff == 0) {
+            if (__atomic_compare_exchange_n(&dlog_enqueue_pos, &pos, pos + 1, true,
+                                            __ATOMIC_RELAXED, __ATOMIC_RELAXED)) {
+                break;
+            }
+        } else if (diff < 0) {
+            // Ring full: drop rather than stall the caller
+            __atomic_fetch_add(&dlog_drop_count, 1, __ATOMIC_RELAXED);
+            return false;
+        } else {
+            pos = __atomic_load_n(&dlog_enqueue_pos, __ATOMIC_RELAXED);
+        }
+    }
+
+    slot->timestamp_us = (uint32_t)hal_time_us();
+    slot->fmt = fmt;
+    slot->level = level;
+    slot->nargs = nargs;
+    for (uint8_t i = 0; i < nargs; i++) {
+        slot->args[i] = args[i];
+    }
+    __atomic_store_n(&slot->seq, pos + 1 - (pos & DLOG_RING_MASK), __ATOMIC_RELEASE);
+    return true;
+}
+
+#if CONFIG_DLOG_OUTPUT_TEXT
+// Print a format string consuming 32-bit arguments. One printf per
+// conversion keeps float promotion correct without va_list tricks.
+static void dlog_print_formatted(const char *fmt, const uint32_t *args, uint8_t nargs) {
+    char spec[16];
+    uint8_t arg = 0;
+
+    while (*fmt) {
+        if (*fmt != '%') {
+            putchar(*fmt++);
+            continue;
+        }
+        if (fmt[1] == '%') {
+            putchar('%');
+            fmt += 2;
+            continue;
+        }
+
+        // Copy "%[flags][width][.prec]" then the conversion, skipping length modifiers
+        size_t len = 0;
+        spec[len++] = *fmt++;
+        while (*fmt && strchr("-+ #0123456789.", *fmt) && len < sizeof(spec) - 3) {
+            spec[len++] = *fmt++;
+        }
+        while (*fmt && strchr("hlzjt", *fmt)) {
+            fmt++;
+        }
+        char conv = *fmt ? *fmt++ : 'd';
+        uint32_t value = arg < nargs ? args[arg++] : 0;
+
+        switch (conv) {
+            case 'f': case 'e': case 'g': case 'F': case 'E': case 'G': {
+                float f;
+                memcpy(&f, &value, sizeof(f));
+                spec[len++] = conv;
+                spec[len] = '\0';
+                printf(spec, (double)f);
+                break;
+            }
+            case 'd': case 'i':
+                spec[len++] = 'l';
+                spec[len++] = conv;
+                spec[len] = '\0';
+                printf(spec, (long)(int32_t)value);
+                break;
+            default: 					// u, x, X, c, o
+                if (conv != 'c') spec[len++] = 'l';
+                spec[len++] = conv;
+                spec[len] = '\0';
+                if (conv == 'c') printf(spec, (int)value);
+                else printf(spec, (unsigned long)value);
+                break;
+        }
+    }
+}
+#endif
+
+static void dlog_emit(const dlog_slot_t *msg) {
+    char level = dlog_level_chars[msg->level < sizeof(dlog_level_chars) ? msg->level : 0];
+
+#if CONFIG_DLOG_OUTPUT_TEXT
+    const dlog_format_entry_t *entry = msg->fmt < DLOG_FMT_MAX ? &dlog_formats[msg->fmt] : NULL;
+    if (entry) {
+        printf("%c (%lu) %s: ", level, (unsigned long)(msg->timestamp_us / 1000), entry->tag);
+        dlog_print_formatted(entry->fmt, msg->args, msg->nargs);
+        putchar('\n');
+        return;
+    }
+#endif
+
+    // Compact form, expanded on the host by tools/dlog_decode.py
+    printf("@D %08lx %c %u", (unsigned long)msg->timestamp_us, level, msg->fmt);
+    for (uint8_t i = 0; i < msg->nargs; i++) {
+        printf(" %lx", (unsigned long)msg->args[i]);
+    }
+    putchar('\n');
+}
+
+// Pop one message. Single consumer: callers hold dlog_consumer_lock.
+static bool dlog_pop(dlog_slot_t *out) {
+    uint32_t index = dlog_dequeue_pos & DLOG_RING_MASK;
+    dlog_slot_t *slot = &dlog_ring[index];
+    uint32_t seq = __atomic_load_n(&slot->seq, __ATOMIC_ACQUIRE) + index;
+
+    if ((int32_t)(seq - (dlog_dequeue_pos + 1)) < 0) {
+        return false;
+    }
+
+    *out = *slot;
+    __atomic_store_n(&slot->seq, dlog_dequeue_pos + DLOG_RING_SIZE - index, __ATOMIC_RELEASE);
+    dlog_dequeue_pos++;
+    return true;
+}
+
+static void dlog_drain(void) {
+    dlog_slot_t msg;
+    static uint32_t reported_drops;
+
+    xSemaphoreTake(dlog_consumer_lock, portMAX_DELAY);
+    while (dlog_pop(&msg)) {
+        dlog_emit(&msg);
+    }
+
+    uint32_t drops = __atomic_load_n(&dlog_drop_count, __ATOMIC_RELAXED);
+    if (drops != reported_drops) {
+        printf("W dlog: %lu messages dropped\n", (unsigned long)(drops - reported_drops));
+        reported_drops = drops;
+    }
+    fflush(stdout);
+    xSemaphoreGive(dlog_consumer_lock);
+}
+
+static void dlog_task(void *arg) {
+    while (1) {
+        dlog_drain();
+        vTaskDelay(pdMS_TO_TICKS(DLOG_DRAIN_PERIOD_MS));
+    }
+}
+
+esp_err_t dlog_init(void) {
+    if (dlog_task_handle) return ESP_ERR_INVALID_STATE;
+
+    dlog_consumer_lock = xSemaphoreCreateMutex();
+    if (!dlog_consumer_lock) return ESP_ERR_NO_MEM;
+
+    if (xTaskCreate(dlog_task, "dlog", 3072, NULL, CONFIG_DLOG_TASK_PRIORITY, &dlog_task_handle) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+    return ESP_OK;
+}
+
+void dlog_flush(void) {
+    if (dlog_consumer_lock) {
+        dlog_drain();
+    }
+}
+
+uint32_t dlog_dropped(void) {
+    return __atomic_load_n(&dlog_drop_count, __ATOMIC_RELAXED);
+}
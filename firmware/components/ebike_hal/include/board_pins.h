@@ -0,0 +1,63 @@
+#ifndef BOARD_PINS_H
+#define BOARD_PINS_H
+
+// Pin and channel assignment of the e-bike board (see docs/gpio_map.md)
+
+// Blind spot sensors and indicators
+#define RCWL_RIGHT_GPIO      33
+#define RCWL_LEFT_GPIO       32
+#define BLIND_SPOT_LED_GPIO  35
+#define SYSTEM_ACTIVE_LED    2
+
+// Turn signals
+#define TURN_SIGNAL_RIGHT    14
+#define TURN_SIGNAL_LEFT     13
+
+// Motor control
+#define DAC_OUTPUT_PIN       25  			// Connected to VSP of driver
+#define DAC_OUTPUT_CHANNEL   0  			// DAC channel 1 (GPIO25)
+#define PEDAL_HALL_PIN       27
+#define POTENTIOMETER_PIN    26
+#define POTENTIOMETER_ADC    7  			// ADC1 channel 7
+#define ACCELERATOR_PIN      34
+#define ACCELERATOR_ADC      6  			// ADC1 channel 6
+// HALL1 and HALL2 are UART0 RX and TX: the debug console
+// (CONFIG_EBIKE_CONSOLE) cannot run with the hall sensors wired
+#define HALL1_PIN            3
+#define HALL2_PIN            1
+#define HALL3_PIN            22
+
+// Shared SPI bus: the display and the RC522 are on one host with their
+// own CS lines. A pending display frame is served before the next RC522
+// register access.
+#define SHARED_SPI_HOST      1  			// SPI2_HOST
+#define SHARED_SPI_MOSI_GPIO 23
+#define SHARED_SPI_MISO_GPIO 19
+#define SHARED_SPI_SCLK_GPIO 18
+#define DISPLAY_SPI_PRIORITY 2
+#define RC522_SPI_PRIORITY   1
+
+// Display configuration
+#define DISPLAY_RST_PIN      21
+#define DISPLAY_CE_PIN       2
+#define DISPLAY_DC_PIN       17
+#define DISPLAY_DIN_PIN      SHARED_SPI_MOSI_GPIO
+#define DISPLAY_CLK_PIN      SHARED_SPI_SCLK_GPIO
+#define DISPLAY_SPI_HOST     SHARED_SPI_HOST
+// SSD1306 OLED on the same header instead (CONFIG_DISPLAY_PANEL_SSD1306).
+// DIN and CLK stay with the RC522's SPI bus; the OLED takes the RST and
+// DC lines, which it does not use.
+#define DISPLAY_SDA_PIN      DISPLAY_RST_PIN
+#define DISPLAY_SCL_PIN      DISPLAY_DC_PIN
+#define DISPLAY_I2C_PORT     0
+
+// RFID configuration
+#define RC522_SPI_HOST       SHARED_SPI_HOST
+#define RC522_MISO_GPIO      SHARED_SPI_MISO_GPIO
+#define RC522_MOSI_GPIO      SHARED_SPI_MOSI_GPIO
+#define RC522_SCLK_GPIO      SHARED_SPI_SCLK_GPIO
+#define RC522_SDA_GPIO       5
+#define RC522_RST_GPIO       4
+#define RC522_IRQ_GPIO       16  			// -1 if not wired, the driver then polls
+
+#endif 				// BOARD_PINS_H
@@ -0,0 +1,164 @@
+#ifndef EBIKE_HAL_H
+#define EBIKE_HAL_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Thin hardware abstraction used by the application components.
+// hal_esp32.c maps it onto the ESP-IDF drivers, hal_linux.c onto an
+// in-memory mock (see ebike_hal_mock.h) for the linux target.
+
+#if CONFIG_IDF_TARGET_LINUX
+#define HAL_ISR_ATTR
+#else
+#include "esp_attr.h"
+#define HAL_ISR_ATTR         IRAM_ATTR
+#endif
+
+// Digital I/O
+typedef enum {
+    HAL_PIN_INPUT = 0,
+    HAL_PIN_INPUT_PULLUP,
+    HAL_PIN_OUTPUT,
+} hal_pin_mode_t;
+
+typedef enum {
+    HAL_EDGE_NONE = 0,
+    HAL_EDGE_RISING,
+    HAL_EDGE_FALLING,
+    HAL_EDGE_ANY,
+} hal_edge_t;
+
+typedef void (*hal_isr_t)(void *arg);
+
+esp_err_t hal_dio_config(uint64_t pin_mask, hal_pin_mode_t mode, hal_edge_t edge);
+esp_err_t hal_dio_attach_isr(int pin, hal_isr_t isr, void *arg);
+int hal_dio_read(int pin);
+void hal_dio_write(int pin, int level);
+
+// Analog in (ADC1, 12-bit, 0-3.3V range)
+esp_err_t hal_ain_config(int channel);
+int hal_ain_read(int channel);
+
+// Analog out (8-bit DAC)
+esp_err_t hal_aout_enable(int channel);
+void hal_aout_write(int channel, uint8_t value);
+// Register-level write, safe from ISRs (including IRAM-only ones)
+void hal_aout_write_from_isr(int channel, uint8_t value);
+
+// SPI device
+typedef struct hal_spi_dev *hal_spi_dev_t;
+
+typedef struct {
+    int host; 							// SPI host (1 = SPI2, 2 = SPI3)
+    int pin_mosi;
+    int pin_miso; 						// -1 if unused
+    int pin_sclk;
+} hal_spi_bus_config_t;
+
+typedef struct {
+    const char *name; 						// Profiler label (hal_spi_prof.h)
+    int host;
+    int pin_cs;
+    int pin_dc; 						// Set per hal_spi_queue() transfer, 0 if unused
+    int clock_hz;
+    uint8_t mode; 						// SPI mode 0-3
+    uint8_t queue_size; 					// Transfers hal_spi_queue() keeps in flight
+} hal_spi_dev_config_t;
+
+#define HAL_SPI_MAX_QUEUE    8
+
+// A host can be shared: a second init with the same MOSI/SCLK (and the
+// same MISO, or -1) only takes a reference, and the bus is freed with
+// the last hal_spi_bus_free(). Other pins fail with ESP_ERR_INVALID_STATE.
+esp_err_t hal_spi_bus_init(const hal_spi_bus_config_t *config);
+esp_err_t hal_spi_add_device(const hal_spi_dev_config_t *config, hal_spi_dev_t *out_dev);
+esp_err_t hal_spi_write(hal_spi_dev_t dev, const uint8_t *data, size_t len);
+// Queue a DMA transfer with the device's DC pin at dc while it is clocked
+// out (set from the driver's pre-transfer callback), so command and data
+// segments go back to back. Blocks only when queue_size transfers are
+// already in flight. data must stay valid until hal_spi_wait(), except
+// for transfers of 4 bytes or less, which are copied.
+esp_err_t hal_spi_queue(hal_spi_dev_t dev, const uint8_t *data, size_t len, int dc);
+// Wait for every queued transfer of dev to finish. Do not mix with
+// hal_spi_write() on the same device while transfers are in flight.
+esp_err_t hal_spi_wait(hal_spi_dev_t dev);
+esp_err_t hal_spi_remove_device(hal_spi_dev_t dev);
+esp_err_t hal_spi_bus_free(int host);
+
+// Shared bus arbitration. Every user of a shared host (a HAL device or a
+// driver with its own spi_device) registers a client and holds the bus
+// between hal_spi_acquire() and hal_spi_release(). When the bus is
+// released the waiting client with the highest priority gets it, the
+// longest waiting first among equals.
+typedef struct hal_spi_client *hal_spi_client_t;
+
+typedef struct {
+    int host;
+    const char *name;
+    uint8_t priority; 						// Higher is served first
+} hal_spi_client_config_t;
+
+typedef struct {
+    const char *name;
+    uint8_t priority;
+    uint32_t holds; 						// Bus grants
+    uint32_t contended; 					// Grants that had to wait
+    uint64_t busy_us; 						// Time holding the bus
+    uint64_t wait_us; 						// Time waiting for it
+    uint32_t max_wait_us;
+} hal_spi_client_stats_t;
+
+#define HAL_SPI_MAX_CLIENTS  4 				// Per host
+
+esp_err_t hal_spi_add_client(const hal_spi_client_config_t *config, hal_spi_client_t *out_client);
+// The client must not hold or wait for the bus
+esp_err_t hal_spi_remove_client(hal_spi_client_t client);
+// Blocks until the bus is granted. Not recursive.
+esp_err_t hal_spi_acquire(hal_spi_client_t client);
+void hal_spi_release(hal_spi_client_t client);
+// Counters of the clients of host since the last clear, in registration
+// order. Returns the number of entries; window_us is the time covered.
+size_t hal_spi_get_client_stats(int host, hal_spi_client_stats_t *out, size_t max, int64_t *window_us);
+void hal_spi_clear_client_stats(int host);
+// "spi" console command with the client counters (not on linux)
+esp_err_t hal_spi_register_console_cmd(void);
+
+// I2C master device
+typedef struct hal_i2c_dev *hal_i2c_dev_t;
+
+typedef struct {
+    int port; 							// I2C port (0 or 1)
+    int pin_sda;
+    int pin_scl;
+} hal_i2c_bus_config_t;
+
+typedef struct {
+    int port;
+    uint16_t addr; 						// 7-bit address
+    int clock_hz; 						// SCL, up to 1 MHz
+} hal_i2c_dev_config_t;
+
+esp_err_t hal_i2c_bus_init(const hal_i2c_bus_config_t *config);
+esp_err_t hal_i2c_add_device(const hal_i2c_dev_config_t *config, hal_i2c_dev_t *out_dev);
+// One write transaction (start, address, data, stop); blocks until done
+esp_err_t hal_i2c_write(hal_i2c_dev_t dev, const uint8_t *data, size_t len);
+esp_err_t hal_i2c_remove_device(hal_i2c_dev_t dev);
+esp_err_t hal_i2c_bus_free(int port);
+
+// Timebase
+int64_t hal_time_us(void); 					// Monotonic, safe from ISRs
+void hal_delay_ms(uint32_t ms);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// EBIKE_HAL_H
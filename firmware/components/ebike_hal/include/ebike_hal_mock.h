@@ -0,0 +1,55 @@
+#ifndef EBIKE_HAL_MOCK_H
+#define EBIKE_HAL_MOCK_H
+
+#include "ebike_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Test controls of the linux HAL mock (only available on the linux target)
+
+#define HAL_MOCK_MAX_PINS        40
+#define HAL_MOCK_MAX_ADC         10
+#define HAL_MOCK_MAX_DAC         2
+
+// Reset pins, analog values, SPI and I2C devices and the clock
+void hal_mock_reset(void);
+
+// Drive an input pin. Runs the attached ISR when the change matches its edge.
+void hal_mock_dio_set(int pin, int level);
+// Last level written to a pin
+int hal_mock_dio_get(int pin);
+
+void hal_mock_ain_set(int channel, int raw);
+uint8_t hal_mock_aout_get(int channel);
+
+// Called for every hal_spi_write() with the bytes sent on the bus
+typedef void (*hal_mock_spi_hook_t)(hal_spi_dev_t dev, const uint8_t *data, size_t len, void *ctx);
+void hal_mock_spi_set_hook(hal_mock_spi_hook_t hook, void *ctx);
+
+typedef struct {
+    uint32_t transactions;
+    uint32_t bytes;
+} hal_mock_spi_stats_t;
+
+int hal_mock_spi_cs(hal_spi_dev_t dev);
+hal_mock_spi_stats_t hal_mock_spi_stats(hal_spi_dev_t dev);
+void hal_mock_spi_clear_stats(void);
+
+// Called for every hal_i2c_write() with the bytes of the transaction
+typedef void (*hal_mock_i2c_hook_t)(hal_i2c_dev_t dev, const uint8_t *data, size_t len, void *ctx);
+void hal_mock_i2c_set_hook(hal_mock_i2c_hook_t hook, void *ctx);
+int hal_mock_i2c_addr(hal_i2c_dev_t dev);
+
+// Clock. In manual mode hal_time_us() only moves through
+// hal_mock_time_advance_us() and hal_delay_ms(), so tests are deterministic.
+void hal_mock_time_manual(bool manual);
+void hal_mock_time_set_us(int64_t now_us);
+void hal_mock_time_advance_us(int64_t delta_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// EBIKE_HAL_MOCK_H
@@ -0,0 +1,72 @@
+#ifndef HAL_SPI_PROF_H
+#define HAL_SPI_PROF_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// SPI transaction profiler. A device registers a record and reports the
+// start and end of each transaction from its pre/post-transfer callbacks,
+// so the time measured is the time the transaction held the bus, for
+// polling and queued transfers alike.
+
+#define HAL_SPI_PROF_MAX     8 					// Profiled devices
+// Transaction time histogram: bucket 0 is below 2 us, bucket i counts
+// [2^i, 2^(i+1)) us and the last one everything above
+#define HAL_SPI_PROF_BUCKETS 12
+
+typedef struct hal_spi_prof hal_spi_prof_t;
+
+typedef struct {
+    const char *name;
+    uint32_t transactions;
+    uint32_t polling; 						// Of which polling transfers
+    uint64_t bytes;
+    uint64_t busy_us; 						// Sum of the transaction times
+    uint32_t max_us;
+    uint32_t hist[HAL_SPI_PROF_BUCKETS];
+} hal_spi_prof_stats_t;
+
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+
+// NULL when all records are taken
+hal_spi_prof_t *hal_spi_prof_register(const char *name);
+// Both are safe from ISRs and accept NULL. A device has one transaction
+// on the bus at a time, so the start is kept in its record.
+void hal_spi_prof_begin(hal_spi_prof_t *prof);
+void hal_spi_prof_end(hal_spi_prof_t *prof, size_t bytes, bool polling);
+// Account one transaction of known duration (the linux mock)
+void hal_spi_prof_record(hal_spi_prof_t *prof, size_t bytes, uint32_t us, bool polling);
+// Index of a record in the registration order, 0 for NULL; and back
+uint8_t hal_spi_prof_id(const hal_spi_prof_t *prof);
+hal_spi_prof_t *hal_spi_prof_from_id(uint8_t id);
+
+// Counters since the last clear, in registration order. Returns the
+// number of entries; window_us is the time covered.
+size_t hal_spi_prof_get_stats(hal_spi_prof_stats_t *out, size_t max, int64_t *window_us);
+void hal_spi_prof_clear(void);
+// Forget every record (host tests)
+void hal_spi_prof_reset(void);
+
+#define HAL_SPI_PROF_REGISTER(name)          hal_spi_prof_register(name)
+#define HAL_SPI_PROF_BEGIN(prof)             hal_spi_prof_begin(prof)
+#define HAL_SPI_PROF_END(prof, bytes, poll)  hal_spi_prof_end((prof), (bytes), (poll))
+
+#else
+
+#define HAL_SPI_PROF_REGISTER(name)          ((hal_spi_prof_t *)NULL)
+#define HAL_SPI_PROF_BEGIN(prof)             do { (void)(prof); } while (0)
+#define HAL_SPI_PROF_END(prof, bytes, poll)  do { (void)(prof); } while (0)
+
+#endif 				// CONFIG_EBIKE_HAL_SPI_PROFILE
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// HAL_SPI_PROF_H
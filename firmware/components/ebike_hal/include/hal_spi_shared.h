@@ -0,0 +1,62 @@
+#ifndef HAL_SPI_SHARED_H
+#define HAL_SPI_SHARED_H
+
+#include "ebike_hal.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Bookkeeping of shared SPI hosts, common to both HAL backends. The
+// backends serialize these calls and block or wake the waiting tasks;
+// nothing here sleeps. Exposed for the host tests.
+
+#define HAL_SPI_HOSTS        3 				// SPI1..SPI3, indexed by host number
+
+typedef struct {
+    int refs;
+    hal_spi_bus_config_t config;
+} hal_spi_bus_ref_t;
+
+typedef struct hal_spi_arbiter hal_spi_arbiter_t;
+
+struct hal_spi_client {
+    hal_spi_arbiter_t *arb;
+    bool waiting;
+    int64_t since_us; 						// Start of the current wait or hold
+    hal_spi_client_stats_t stats;
+    void *wake; 						// Backend handle that unblocks a waiter
+};
+
+struct hal_spi_arbiter {
+    struct hal_spi_client *clients[HAL_SPI_MAX_CLIENTS];
+    uint8_t client_count;
+    struct hal_spi_client *owner;
+    int64_t stats_since_us;
+};
+
+// Take a reference on an initialized bus. Returns ESP_ERR_NOT_FOUND when
+// the bus still has to be initialized (then set refs and config).
+esp_err_t hal_spi_bus_ref(hal_spi_bus_ref_t *bus, const hal_spi_bus_config_t *config);
+// Drop a reference. True when it was the last one and the bus must be freed.
+bool hal_spi_bus_unref(hal_spi_bus_ref_t *bus);
+
+esp_err_t hal_spi_arbiter_add(hal_spi_arbiter_t *arb, struct hal_spi_client *client,
+                              const hal_spi_client_config_t *config);
+esp_err_t hal_spi_arbiter_remove(hal_spi_arbiter_t *arb, struct hal_spi_client *client);
+// True when the bus was free and is now held by client. Otherwise client
+// is queued and is handed the bus by a later release.
+bool hal_spi_arbiter_request(hal_spi_arbiter_t *arb, struct hal_spi_client *client, int64_t now_us);
+// Release the bus held by client. Returns the waiter that now holds it,
+// or NULL when the bus is free.
+struct hal_spi_client *hal_spi_arbiter_release(hal_spi_arbiter_t *arb, struct hal_spi_client *client,
+                                               int64_t now_us);
+size_t hal_spi_arbiter_stats(const hal_spi_arbiter_t *arb, hal_spi_client_stats_t *out, size_t max,
+                             int64_t now_us, int64_t *window_us);
+void hal_spi_arbiter_clear(hal_spi_arbiter_t *arb, int64_t now_us);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// HAL_SPI_SHARED_H
@@ -0,0 +1,83 @@
+#include "ebike_hal.h"
+#include "hal_spi_shared.h"
+#include "hal_spi_prof.h"
+#include <stdio.h>
+#include <string.h>
+#include "esp_console.h"
+
+// Shared SPI bus counters for tuning the client priorities (share of the
+// window each client held the bus and how long it waited for it) and the
+// transaction profile of every device
+
+static void spi_print_host(int host) {
+    hal_spi_client_stats_t stats[HAL_SPI_MAX_CLIENTS];
+    int64_t window_us;
+    size_t n = hal_spi_get_client_stats(host, stats, HAL_SPI_MAX_CLIENTS, &window_us);
+    if (!n || window_us <= 0) return;
+
+    printf("SPI%d: %lld ms\n", host + 1, (long long)(window_us / 1000));
+    for (size_t i = 0; i < n; i++) {
+        const hal_spi_client_stats_t *s = &stats[i];
+        printf("  %-6s prio %u: %lu holds, bus %.2f%%, %lu waited %.2f%% (avg %lu us, max %lu us)\n",
+               s->name, s->priority, (unsigned long)s->holds, 100.0 * s->busy_us / window_us,
+               (unsigned long)s->contended, 100.0 * s->wait_us / window_us,
+               (unsigned long)(s->contended ? s->wait_us / s->contended : 0), (unsigned long)s->max_wait_us);
+    }
+}
+
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+static void spi_print_profile(void) {
+    hal_spi_prof_stats_t stats[HAL_SPI_PROF_MAX];
+    int64_t window_us;
+    size_t n = hal_spi_prof_get_stats(stats, HAL_SPI_PROF_MAX, &window_us);
+    if (!n || window_us <= 0) return;
+
+    printf("transactions: %lld ms\n", (long long)(window_us / 1000));
+    for (size_t i = 0; i < n; i++) {
+        const hal_spi_prof_stats_t *s = &stats[i];
+        printf("  %-6s %lu (%lu polling), %.1f/s, %llu bytes, bus %.2f%%, avg %lu us, max %lu us\n",
+               s->name, (unsigned long)s->transactions, (unsigned long)s->polling,
+               1e6 * s->transactions / window_us, (unsigned long long)s->bytes,
+               100.0 * s->busy_us / window_us,
+               (unsigned long)(s->transactions ? s->busy_us / s->transactions : 0), (unsigned long)s->max_us);
+        if (!s->transactions) continue;
+
+        // Histogram buckets by lower bound in us, empty ones left out
+        printf("        ");
+        for (int b = 0; b < HAL_SPI_PROF_BUCKETS; b++) {
+            if (s->hist[b]) printf(" %s%lu:%lu", b ? "" : "<", b ? 1ul << b : 2ul, (unsigned long)s->hist[b]);
+        }
+        printf("\n");
+    }
+}
+#endif
+
+static int spi_cmd(int argc, char **argv) {
+    bool clear = argc > 1 && strcmp(argv[1], "clear") == 0;
+    for (int host = 1; host < HAL_SPI_HOSTS; host++) {
+        if (clear) {
+            hal_spi_clear_client_stats(host);
+        } else {
+            spi_print_host(host);
+        }
+    }
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+    if (clear) {
+        hal_spi_prof_clear();
+    } else {
+        spi_print_profile();
+    }
+#endif
+    return 0;
+}
+
+esp_err_t hal_spi_register_console_cmd(void) {
+    const esp_console_cmd_t cmd = {
+        .command = "spi",
+        .help = "SPI bus time and wait per shared bus client, and transactions, bytes and "
+                "transaction time histogram per device, since the last clear",
+        .hint = "[clear]",
+        .func = spi_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
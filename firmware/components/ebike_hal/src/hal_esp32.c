@@ -0,0 +1,397 @@
+#include "ebike_hal.h"
+#include "hal_spi_shared.h"
+#include "hal_spi_prof.h"
+#include <stdlib.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "driver/gpio.h"
+#include "driver/adc.h"
+#include "driver/dac.h"
+#include "hal/dac_ll.h"
+#include "hal/gpio_ll.h"
+#include "driver/spi_master.h"
+#include "driver/i2c_master.h"
+#include "esp_timer.h"
+#include "esp_log.h"
+
+static const char *TAG = "HAL";
+
+// DC level and pin of a queued transfer and the profiler record of the
+// device, packed into spi_transaction_t.user
+#define HAL_SPI_DC_VALID     0x2
+#define HAL_SPI_DC_PIN_SHIFT 2
+#define HAL_SPI_DC_PIN_MASK  0x3F
+#define HAL_SPI_PROF_SHIFT   8
+
+struct hal_spi_dev {
+    spi_device_handle_t handle;
+    int pin_dc;
+    uintptr_t prof_id; 						// hal_spi_prof_id() << HAL_SPI_PROF_SHIFT
+    uint8_t queue_size;
+    uint8_t in_flight;
+    uint8_t next; 						// Oldest slot is next once the ring is full
+    spi_transaction_t trans[HAL_SPI_MAX_QUEUE];
+};
+
+struct hal_i2c_dev {
+    i2c_master_dev_handle_t handle;
+};
+
+#define HAL_I2C_TIMEOUT_MS   100
+
+static hal_spi_bus_ref_t spi_buses[HAL_SPI_HOSTS];
+static hal_spi_arbiter_t spi_arbiters[HAL_SPI_HOSTS];
+static portMUX_TYPE spi_arbiter_lock = portMUX_INITIALIZER_UNLOCKED;
+
+static i2c_master_bus_handle_t i2c_buses[SOC_I2C_NUM];
+static bool isr_service_installed = false;
+static bool adc_width_configured = false;
+
+// Digital I/O
+
+esp_err_t hal_dio_config(uint64_t pin_mask, hal_pin_mode_t mode, hal_edge_t edge) {
+    static const gpio_int_type_t intr_types[] = {
+        [HAL_EDGE_NONE] = GPIO_INTR_DISABLE,
+        [HAL_EDGE_RISING] = GPIO_INTR_POSEDGE,
+        [HAL_EDGE_FALLING] = GPIO_INTR_NEGEDGE,
+        [HAL_EDGE_ANY] = GPIO_INTR_ANYEDGE,
+    };
+
+    gpio_config_t io_conf = {
+        .pin_bit_mask = pin_mask,
+        .mode = mode == HAL_PIN_OUTPUT ? GPIO_MODE_OUTPUT : GPIO_MODE_INPUT,
+        .pull_up_en = mode == HAL_PIN_INPUT_PULLUP ? GPIO_PULLUP_ENABLE : GPIO_PULLUP_DISABLE,
+        .intr_type = intr_types[edge],
+    };
+    return gpio_config(&io_conf);
+}
+
+esp_err_t hal_dio_attach_isr(int pin, hal_isr_t isr, void *arg) {
+    if (!isr_service_installed) {
+        esp_err_t ret = gpio_install_isr_service(0);
+        if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+            ESP_LOGE(TAG, "ISR service install failed: %s", esp_err_to_name(ret));
+            return ret;
+        }
+        isr_service_installed = true;
+    }
+    return gpio_isr_handler_add((gpio_num_t)pin, isr, arg);
+}
+
+int hal_dio_read(int pin) {
+    return gpio_get_level((gpio_num_t)pin);
+}
+
+void hal_dio_write(int pin, int level) {
+    gpio_set_level((gpio_num_t)pin, level);
+}
+
+// Analog in
+
+esp_err_t hal_ain_config(int channel) {
+    if (!adc_width_configured) {
+        adc1_config_width(ADC_WIDTH_BIT_12);
+        adc_width_configured = true;
+    }
+    return adc1_config_channel_atten((adc1_channel_t)channel, ADC_ATTEN_DB_11);
+}
+
+int hal_ain_read(int channel) {
+    return adc1_get_raw((adc1_channel_t)channel);
+}
+
+// Analog out
+
+esp_err_t hal_aout_enable(int channel) {
+    return dac_output_enable((dac_channel_t)channel);
+}
+
+void hal_aout_write(int channel, uint8_t value) {
+    dac_output_voltage((dac_channel_t)channel, value);
+}
+
+void HAL_ISR_ATTR hal_aout_write_from_isr(int channel, uint8_t value) {
+    dac_ll_update_output_value((dac_channel_t)channel, value);
+}
+
+// SPI
+
+// Bus references are only taken at startup, from one task
+esp_err_t hal_spi_bus_init(const hal_spi_bus_config_t *config) {
+    if (config->host <= 0 || config->host >= HAL_SPI_HOSTS) return ESP_ERR_INVALID_ARG;
+
+    hal_spi_bus_ref_t *bus = &spi_buses[config->host];
+    esp_err_t ret = hal_spi_bus_ref(bus, config);
+    if (ret != ESP_ERR_NOT_FOUND) return ret;
+
+    spi_bus_config_t buscfg = {
+        .mosi_io_num = config->pin_mosi,
+        .miso_io_num = config->pin_miso,
+        .sclk_io_num = config->pin_sclk,
+        .quadwp_io_num = -1,
+        .quadhd_io_num = -1,
+        .max_transfer_sz = 0
+    };
+    ret = spi_bus_initialize((spi_host_device_t)config->host, &buscfg, SPI_DMA_CH_AUTO);
+    if (ret != ESP_OK) return ret;
+    bus->refs = 1;
+    bus->config = *config;
+    return ESP_OK;
+}
+
+// Runs in the SPI ISR right before a transfer starts. Polling transfers
+// carry no DC and are left alone.
+static void HAL_ISR_ATTR hal_spi_pre_cb(spi_transaction_t *t) {
+    uintptr_t user = (uintptr_t)t->user;
+    if (user & HAL_SPI_DC_VALID) {
+        gpio_ll_set_level(&GPIO, (user >> HAL_SPI_DC_PIN_SHIFT) & HAL_SPI_DC_PIN_MASK, user & 1);
+    }
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+    hal_spi_prof_begin(hal_spi_prof_from_id(user >> HAL_SPI_PROF_SHIFT));
+#endif
+}
+
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+// Only queued transfers set DC
+static void HAL_ISR_ATTR hal_spi_post_cb(spi_transaction_t *t) {
+    uintptr_t user = (uintptr_t)t->user;
+    hal_spi_prof_end(hal_spi_prof_from_id(user >> HAL_SPI_PROF_SHIFT), t->length / 8, !(user & HAL_SPI_DC_VALID));
+}
+#endif
+
+esp_err_t hal_spi_add_device(const hal_spi_dev_config_t *config, hal_spi_dev_t *out_dev) {
+    hal_spi_dev_t dev = calloc(1, sizeof(struct hal_spi_dev));
+    if (!dev) return ESP_ERR_NO_MEM;
+
+    dev->pin_dc = config->pin_dc;
+    dev->queue_size = config->queue_size ? config->queue_size : 1;
+    if (dev->queue_size > HAL_SPI_MAX_QUEUE) dev->queue_size = HAL_SPI_MAX_QUEUE;
+
+    spi_device_interface_config_t devcfg = {
+        .mode = config->mode,
+        .clock_speed_hz = config->clock_hz,
+        .spics_io_num = config->pin_cs,
+        .queue_size = dev->queue_size,
+        .pre_cb = config->pin_dc > 0 ? hal_spi_pre_cb : NULL,
+    };
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+    hal_spi_prof_t *prof = hal_spi_prof_register(config->name ? config->name : "spi");
+    dev->prof_id = (uintptr_t)hal_spi_prof_id(prof) << HAL_SPI_PROF_SHIFT;
+    if (prof) {
+        devcfg.pre_cb = hal_spi_pre_cb;
+        devcfg.post_cb = hal_spi_post_cb;
+    }
+#endif
+    esp_err_t ret = spi_bus_add_device((spi_host_device_t)config->host, &devcfg, &dev->handle);
+    if (ret != ESP_OK) {
+        free(dev);
+        return ret;
+    }
+
+    *out_dev = dev;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_write(hal_spi_dev_t dev, const uint8_t *data, size_t len) {
+    spi_transaction_t t = {
+        .length = 8 * len,
+        .tx_buffer = data,
+        .user = (void *)dev->prof_id,
+    };
+    return spi_device_polling_transmit(dev->handle, &t);
+}
+
+static esp_err_t hal_spi_collect(hal_spi_dev_t dev) {
+    spi_transaction_t *done;
+    esp_err_t ret = spi_device_get_trans_result(dev->handle, &done, portMAX_DELAY);
+    if (ret == ESP_OK) dev->in_flight--;
+    return ret;
+}
+
+esp_err_t hal_spi_queue(hal_spi_dev_t dev, const uint8_t *data, size_t len, int dc) {
+    if (dev->pin_dc <= 0) return ESP_ERR_INVALID_STATE;
+
+    // Ring of transaction slots, freed in order as results come back
+    if (dev->in_flight == dev->queue_size) {
+        esp_err_t ret = hal_spi_collect(dev);
+        if (ret != ESP_OK) return ret;
+    }
+    spi_transaction_t *t = &dev->trans[dev->next];
+    memset(t, 0, sizeof(*t));
+    t->length = 8 * len;
+    t->user = (void *)(HAL_SPI_DC_VALID | (dc ? 1 : 0) | ((uintptr_t)dev->pin_dc << HAL_SPI_DC_PIN_SHIFT) |
+                       dev->prof_id);
+    if (len <= sizeof(t->tx_data)) {
+        t->flags = SPI_TRANS_USE_TXDATA;
+        memcpy(t->tx_data, data, len);
+    } else {
+        t->tx_buffer = data;
+    }
+
+    esp_err_t ret = spi_device_queue_trans(dev->handle, t, portMAX_DELAY);
+    if (ret != ESP_OK) return ret;
+    dev->next = (dev->next + 1) % dev->queue_size;
+    dev->in_flight++;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_wait(hal_spi_dev_t dev) {
+    while (dev->in_flight) {
+        esp_err_t ret = hal_spi_collect(dev);
+        if (ret != ESP_OK) return ret;
+    }
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_remove_device(hal_spi_dev_t dev) {
+    esp_err_t ret = spi_bus_remove_device(dev->handle);
+    if (ret == ESP_OK) free(dev);
+    return ret;
+}
+
+esp_err_t hal_spi_bus_free(int host) {
+    if (host <= 0 || host >= HAL_SPI_HOSTS) return ESP_ERR_INVALID_ARG;
+    if (!hal_spi_bus_unref(&spi_buses[host])) return ESP_OK;
+    return spi_bus_free((spi_host_device_t)host);
+}
+
+// Shared bus arbitration. The bookkeeping runs in a critical section;
+// a client that has to wait blocks on its own semaphore, which the
+// releasing client gives once the bus is handed over.
+
+esp_err_t hal_spi_add_client(const hal_spi_client_config_t *config, hal_spi_client_t *out_client) {
+    if (config->host <= 0 || config->host >= HAL_SPI_HOSTS) return ESP_ERR_INVALID_ARG;
+
+    hal_spi_client_t client = calloc(1, sizeof(struct hal_spi_client));
+    if (!client) return ESP_ERR_NO_MEM;
+    client->wake = xSemaphoreCreateBinary();
+    if (!client->wake) {
+        free(client);
+        return ESP_ERR_NO_MEM;
+    }
+
+    portENTER_CRITICAL(&spi_arbiter_lock);
+    esp_err_t ret = hal_spi_arbiter_add(&spi_arbiters[config->host], client, config);
+    portEXIT_CRITICAL(&spi_arbiter_lock);
+    if (ret != ESP_OK) {
+        vSemaphoreDelete(client->wake);
+        free(client);
+        return ret;
+    }
+
+    *out_client = client;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_remove_client(hal_spi_client_t client) {
+    portENTER_CRITICAL(&spi_arbiter_lock);
+    esp_err_t ret = hal_spi_arbiter_remove(client->arb, client);
+    portEXIT_CRITICAL(&spi_arbiter_lock);
+    if (ret != ESP_OK) return ret;
+
+    vSemaphoreDelete(client->wake);
+    free(client);
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_acquire(hal_spi_client_t client) {
+    portENTER_CRITICAL(&spi_arbiter_lock);
+    bool granted = hal_spi_arbiter_request(client->arb, client, hal_time_us());
+    portEXIT_CRITICAL(&spi_arbiter_lock);
+
+    if (!granted) xSemaphoreTake(client->wake, portMAX_DELAY);
+    return ESP_OK;
+}
+
+void hal_spi_release(hal_spi_client_t client) {
+    portENTER_CRITICAL(&spi_arbiter_lock);
+    hal_spi_client_t next = hal_spi_arbiter_release(client->arb, client, hal_time_us());
+    portEXIT_CRITICAL(&spi_arbiter_lock);
+
+    if (next) xSemaphoreGive(next->wake);
+}
+
+size_t hal_spi_get_client_stats(int host, hal_spi_client_stats_t *out, size_t max, int64_t *window_us) {
+    if (host <= 0 || host >= HAL_SPI_HOSTS) return 0;
+
+    portENTER_CRITICAL(&spi_arbiter_lock);
+    size_t n = hal_spi_arbiter_stats(&spi_arbiters[host], out, max, hal_time_us(), window_us);
+    portEXIT_CRITICAL(&spi_arbiter_lock);
+    return n;
+}
+
+void hal_spi_clear_client_stats(int host) {
+    if (host <= 0 || host >= HAL_SPI_HOSTS) return;
+
+    portENTER_CRITICAL(&spi_arbiter_lock);
+    hal_spi_arbiter_clear(&spi_arbiters[host], hal_time_us());
+    portEXIT_CRITICAL(&spi_arbiter_lock);
+}
+
+// I2C
+
+esp_err_t hal_i2c_bus_init(const hal_i2c_bus_config_t *config) {
+    if (config->port < 0 || config->port >= SOC_I2C_NUM) return ESP_ERR_INVALID_ARG;
+    if (i2c_buses[config->port]) return ESP_ERR_INVALID_STATE;
+
+    i2c_master_bus_config_t buscfg = {
+        .i2c_port = config->port,
+        .sda_io_num = config->pin_sda,
+        .scl_io_num = config->pin_scl,
+        .clk_source = I2C_CLK_SRC_DEFAULT,
+        .glitch_ignore_cnt = 7,
+        .flags.enable_internal_pullup = true,
+    };
+    return i2c_new_master_bus(&buscfg, &i2c_buses[config->port]);
+}
+
+esp_err_t hal_i2c_add_device(const hal_i2c_dev_config_t *config, hal_i2c_dev_t *out_dev) {
+    if (config->port < 0 || config->port >= SOC_I2C_NUM || !i2c_buses[config->port]) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    hal_i2c_dev_t dev = calloc(1, sizeof(struct hal_i2c_dev));
+    if (!dev) return ESP_ERR_NO_MEM;
+
+    i2c_device_config_t devcfg = {
+        .dev_addr_length = I2C_ADDR_BIT_LEN_7,
+        .device_address = config->addr,
+        .scl_speed_hz = config->clock_hz,
+    };
+    esp_err_t ret = i2c_master_bus_add_device(i2c_buses[config->port], &devcfg, &dev->handle);
+    if (ret != ESP_OK) {
+        free(dev);
+        return ret;
+    }
+
+    *out_dev = dev;
+    return ESP_OK;
+}
+
+esp_err_t hal_i2c_write(hal_i2c_dev_t dev, const uint8_t *data, size_t len) {
+    return i2c_master_transmit(dev->handle, data, len, HAL_I2C_TIMEOUT_MS);
+}
+
+esp_err_t hal_i2c_remove_device(hal_i2c_dev_t dev) {
+    esp_err_t ret = i2c_master_bus_rm_device(dev->handle);
+    if (ret == ESP_OK) free(dev);
+    return ret;
+}
+
+esp_err_t hal_i2c_bus_free(int port) {
+    if (port < 0 || port >= SOC_I2C_NUM || !i2c_buses[port]) return ESP_ERR_INVALID_STATE;
+    esp_err_t ret = i2c_del_master_bus(i2c_buses[port]);
+    if (ret == ESP_OK) i2c_buses[port] = NULL;
+    return ret;
+}
+
+// Timebase
+
+int64_t HAL_ISR_ATTR hal_time_us(void) {
+    return esp_timer_get_time();
+}
+
+void hal_delay_ms(uint32_t ms) {
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
@@ -0,0 +1,368 @@
+#include "ebike_hal.h"
+#include "ebike_hal_mock.h"
+#include "hal_spi_shared.h"
+#include "hal_spi_prof.h"
+#include <string.h>
+#include <time.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+
+#define HAL_MOCK_MAX_SPI_DEVS    8
+#define HAL_MOCK_MAX_I2C_DEVS    4
+
+struct hal_spi_dev {
+    int host;
+    int pin_cs;
+    int pin_dc;
+    int clock_hz;
+    bool queued; 						// Set by hal_spi_queue() for the write
+    hal_spi_prof_t *prof;
+    hal_mock_spi_stats_t stats;
+};
+
+struct hal_i2c_dev {
+    int port;
+    uint16_t addr;
+};
+
+typedef struct {
+    hal_pin_mode_t mode;
+    hal_edge_t edge;
+    int level;
+    hal_isr_t isr;
+    void *isr_arg;
+} mock_pin_t;
+
+static mock_pin_t pins[HAL_MOCK_MAX_PINS];
+static int ain_values[HAL_MOCK_MAX_ADC];
+static uint8_t aout_values[HAL_MOCK_MAX_DAC];
+
+static struct hal_spi_dev spi_devs[HAL_MOCK_MAX_SPI_DEVS];
+static int spi_dev_count;
+static hal_mock_spi_hook_t spi_hook;
+static void *spi_hook_ctx;
+
+static hal_spi_bus_ref_t spi_buses[HAL_SPI_HOSTS];
+static hal_spi_arbiter_t spi_arbiters[HAL_SPI_HOSTS];
+static struct hal_spi_client spi_clients[HAL_SPI_HOSTS * HAL_SPI_MAX_CLIENTS];
+
+static struct hal_i2c_dev i2c_devs[HAL_MOCK_MAX_I2C_DEVS];
+static int i2c_dev_count;
+static hal_mock_i2c_hook_t i2c_hook;
+static void *i2c_hook_ctx;
+
+static bool time_manual;
+static int64_t time_now_us;
+
+void hal_mock_reset(void) {
+    memset(pins, 0, sizeof(pins));
+    memset(ain_values, 0, sizeof(ain_values));
+    memset(aout_values, 0, sizeof(aout_values));
+    memset(spi_devs, 0, sizeof(spi_devs));
+    spi_dev_count = 0;
+    spi_hook = NULL;
+    spi_hook_ctx = NULL;
+    memset(spi_buses, 0, sizeof(spi_buses));
+    memset(spi_arbiters, 0, sizeof(spi_arbiters));
+    memset(spi_clients, 0, sizeof(spi_clients));
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+    hal_spi_prof_reset();
+#endif
+    memset(i2c_devs, 0, sizeof(i2c_devs));
+    i2c_dev_count = 0;
+    i2c_hook = NULL;
+    i2c_hook_ctx = NULL;
+    time_manual = false;
+    time_now_us = 0;
+}
+
+// Digital I/O
+
+esp_err_t hal_dio_config(uint64_t pin_mask, hal_pin_mode_t mode, hal_edge_t edge) {
+    for (int pin = 0; pin < HAL_MOCK_MAX_PINS; pin++) {
+        if (pin_mask & (1ULL << pin)) {
+            pins[pin].mode = mode;
+            pins[pin].edge = edge;
+            // Pull-ups idle high
+            if (mode == HAL_PIN_INPUT_PULLUP) pins[pin].level = 1;
+        }
+    }
+    return ESP_OK;
+}
+
+esp_err_t hal_dio_attach_isr(int pin, hal_isr_t isr, void *arg) {
+    if (pin < 0 || pin >= HAL_MOCK_MAX_PINS) return ESP_ERR_INVALID_ARG;
+    pins[pin].isr = isr;
+    pins[pin].isr_arg = arg;
+    return ESP_OK;
+}
+
+int hal_dio_read(int pin) {
+    return (pin >= 0 && pin < HAL_MOCK_MAX_PINS) ? pins[pin].level : 0;
+}
+
+void hal_dio_write(int pin, int level) {
+    if (pin >= 0 && pin < HAL_MOCK_MAX_PINS) pins[pin].level = level ? 1 : 0;
+}
+
+void hal_mock_dio_set(int pin, int level) {
+    if (pin < 0 || pin >= HAL_MOCK_MAX_PINS) return;
+
+    mock_pin_t *p = &pins[pin];
+    int old = p->level;
+    p->level = level ? 1 : 0;
+
+    bool fire = (p->edge == HAL_EDGE_RISING && !old && p->level)
+             || (p->edge == HAL_EDGE_FALLING && old && !p->level)
+             || (p->edge == HAL_EDGE_ANY && old != p->level);
+    if (fire && p->isr) {
+        p->isr(p->isr_arg);
+    }
+}
+
+int hal_mock_dio_get(int pin) {
+    return hal_dio_read(pin);
+}
+
+// Analog in/out
+
+esp_err_t hal_ain_config(int channel) {
+    return (channel >= 0 && channel < HAL_MOCK_MAX_ADC) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+int hal_ain_read(int channel) {
+    return (channel >= 0 && channel < HAL_MOCK_MAX_ADC) ? ain_values[channel] : 0;
+}
+
+void hal_mock_ain_set(int channel, int raw) {
+    if (channel >= 0 && channel < HAL_MOCK_MAX_ADC) ain_values[channel] = raw;
+}
+
+esp_err_t hal_aout_enable(int channel) {
+    return (channel >= 0 && channel < HAL_MOCK_MAX_DAC) ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+void hal_aout_write(int channel, uint8_t value) {
+    if (channel >= 0 && channel < HAL_MOCK_MAX_DAC) aout_values[channel] = value;
+}
+
+void hal_aout_write_from_isr(int channel, uint8_t value) {
+    hal_aout_write(channel, value);
+}
+
+uint8_t hal_mock_aout_get(int channel) {
+    return (channel >= 0 && channel < HAL_MOCK_MAX_DAC) ? aout_values[channel] : 0;
+}
+
+// SPI
+
+esp_err_t hal_spi_bus_init(const hal_spi_bus_config_t *config) {
+    if (!config || config->host <= 0 || config->host >= HAL_SPI_HOSTS) return ESP_ERR_INVALID_ARG;
+
+    hal_spi_bus_ref_t *bus = &spi_buses[config->host];
+    esp_err_t ret = hal_spi_bus_ref(bus, config);
+    if (ret != ESP_ERR_NOT_FOUND) return ret;
+    bus->refs = 1;
+    bus->config = *config;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_add_device(const hal_spi_dev_config_t *config, hal_spi_dev_t *out_dev) {
+    if (!config || !out_dev) return ESP_ERR_INVALID_ARG;
+    if (spi_dev_count >= HAL_MOCK_MAX_SPI_DEVS) return ESP_ERR_NO_MEM;
+
+    hal_spi_dev_t dev = &spi_devs[spi_dev_count++];
+    dev->host = config->host;
+    dev->pin_cs = config->pin_cs;
+    dev->pin_dc = config->pin_dc;
+    dev->clock_hz = config->clock_hz;
+    dev->prof = HAL_SPI_PROF_REGISTER(config->name ? config->name : "spi");
+    *out_dev = dev;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_write(hal_spi_dev_t dev, const uint8_t *data, size_t len) {
+    if (!dev || (!data && len)) return ESP_ERR_INVALID_ARG;
+
+    dev->stats.transactions++;
+    dev->stats.bytes += len;
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+    // No bus here: charge the wire time at the device clock
+    uint32_t wire_us = dev->clock_hz > 0 ? (uint32_t)((uint64_t)len * 8 * 1000000 / dev->clock_hz) : 0;
+    hal_spi_prof_record(dev->prof, len, wire_us, !dev->queued);
+#endif
+    if (spi_hook) {
+        spi_hook(dev, data, len, spi_hook_ctx);
+    }
+    return ESP_OK;
+}
+
+// Transfers complete immediately; DC is set first, as the pre-transfer
+// callback does on target
+esp_err_t hal_spi_queue(hal_spi_dev_t dev, const uint8_t *data, size_t len, int dc) {
+    if (!dev) return ESP_ERR_INVALID_ARG;
+    if (dev->pin_dc <= 0) return ESP_ERR_INVALID_STATE;
+
+    hal_dio_write(dev->pin_dc, dc);
+    dev->queued = true;
+    esp_err_t ret = hal_spi_write(dev, data, len);
+    dev->queued = false;
+    return ret;
+}
+
+esp_err_t hal_spi_wait(hal_spi_dev_t dev) {
+    return dev ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t hal_spi_remove_device(hal_spi_dev_t dev) {
+    // Slots are only reclaimed by hal_mock_reset()
+    return dev ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t hal_spi_bus_free(int host) {
+    if (host <= 0 || host >= HAL_SPI_HOSTS) return ESP_ERR_INVALID_ARG;
+    hal_spi_bus_unref(&spi_buses[host]);
+    return ESP_OK;
+}
+
+// There is no other task to hand the bus over, so a contended acquire
+// fails instead of blocking. The host tests drive the arbiter directly
+// (hal_spi_shared.h) to check the order of grants.
+
+esp_err_t hal_spi_add_client(const hal_spi_client_config_t *config, hal_spi_client_t *out_client) {
+    if (!config || !out_client || config->host <= 0 || config->host >= HAL_SPI_HOSTS) return ESP_ERR_INVALID_ARG;
+
+    // Free slots have no arbiter; removed clients give theirs back
+    hal_spi_client_t client = NULL;
+    for (int i = 0; i < HAL_SPI_HOSTS * HAL_SPI_MAX_CLIENTS && !client; i++) {
+        if (!spi_clients[i].arb) client = &spi_clients[i];
+    }
+    if (!client) return ESP_ERR_NO_MEM;
+
+    esp_err_t ret = hal_spi_arbiter_add(&spi_arbiters[config->host], client, config);
+    if (ret != ESP_OK) return ret;
+    *out_client = client;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_remove_client(hal_spi_client_t client) {
+    if (!client || !client->arb) return ESP_ERR_INVALID_ARG;
+    return hal_spi_arbiter_remove(client->arb, client);
+}
+
+esp_err_t hal_spi_acquire(hal_spi_client_t client) {
+    if (!client) return ESP_ERR_INVALID_ARG;
+    if (client->arb->owner) return ESP_ERR_INVALID_STATE;
+
+    hal_spi_arbiter_request(client->arb, client, hal_time_us());
+    return ESP_OK;
+}
+
+void hal_spi_release(hal_spi_client_t client) {
+    if (client) hal_spi_arbiter_release(client->arb, client, hal_time_us());
+}
+
+size_t hal_spi_get_client_stats(int host, hal_spi_client_stats_t *out, size_t max, int64_t *window_us) {
+    if (host <= 0 || host >= HAL_SPI_HOSTS) return 0;
+    return hal_spi_arbiter_stats(&spi_arbiters[host], out, max, hal_time_us(), window_us);
+}
+
+void hal_spi_clear_client_stats(int host) {
+    if (host > 0 && host < HAL_SPI_HOSTS) hal_spi_arbiter_clear(&spi_arbiters[host], hal_time_us());
+}
+
+esp_err_t hal_spi_register_console_cmd(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void hal_mock_spi_set_hook(hal_mock_spi_hook_t hook, void *ctx) {
+    spi_hook = hook;
+    spi_hook_ctx = ctx;
+}
+
+int hal_mock_spi_cs(hal_spi_dev_t dev) {
+    return dev ? dev->pin_cs : -1;
+}
+
+hal_mock_spi_stats_t hal_mock_spi_stats(hal_spi_dev_t dev) {
+    return dev ? dev->stats : (hal_mock_spi_stats_t) { 0 };
+}
+
+void hal_mock_spi_clear_stats(void) {
+    for (int i = 0; i < spi_dev_count; i++) {
+        memset(&spi_devs[i].stats, 0, sizeof(spi_devs[i].stats));
+    }
+}
+
+// I2C
+
+esp_err_t hal_i2c_bus_init(const hal_i2c_bus_config_t *config) {
+    return config ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t hal_i2c_add_device(const hal_i2c_dev_config_t *config, hal_i2c_dev_t *out_dev) {
+    if (!config || !out_dev) return ESP_ERR_INVALID_ARG;
+    if (i2c_dev_count >= HAL_MOCK_MAX_I2C_DEVS) return ESP_ERR_NO_MEM;
+
+    hal_i2c_dev_t dev = &i2c_devs[i2c_dev_count++];
+    dev->port = config->port;
+    dev->addr = config->addr;
+    *out_dev = dev;
+    return ESP_OK;
+}
+
+esp_err_t hal_i2c_write(hal_i2c_dev_t dev, const uint8_t *data, size_t len) {
+    if (!dev || (!data && len)) return ESP_ERR_INVALID_ARG;
+    if (i2c_hook) {
+        i2c_hook(dev, data, len, i2c_hook_ctx);
+    }
+    return ESP_OK;
+}
+
+esp_err_t hal_i2c_remove_device(hal_i2c_dev_t dev) {
+    // Slots are only reclaimed by hal_mock_reset()
+    return dev ? ESP_OK : ESP_ERR_INVALID_ARG;
+}
+
+esp_err_t hal_i2c_bus_free(int port) {
+    return ESP_OK;
+}
+
+void hal_mock_i2c_set_hook(hal_mock_i2c_hook_t hook, void *ctx) {
+    i2c_hook = hook;
+    i2c_hook_ctx = ctx;
+}
+
+int hal_mock_i2c_addr(hal_i2c_dev_t dev) {
+    return dev ? dev->addr : -1;
+}
+
+// Timebase
+
+int64_t hal_time_us(void) {
+    if (time_manual) return time_now_us;
+
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+void hal_delay_ms(uint32_t ms) {
+    if (time_manual) {
+        time_now_us += (int64_t)ms * 1000;
+        return;
+    }
+    vTaskDelay(pdMS_TO_TICKS(ms));
+}
+
+void hal_mock_time_manual(bool manual) {
+    time_manual = manual;
+}
+
+void hal_mock_time_set_us(int64_t now_us) {
+    time_now_us = now_us;
+}
+
+void hal_mock_time_advance_us(int64_t delta_us) {
+    time_now_us += delta_us;
+}
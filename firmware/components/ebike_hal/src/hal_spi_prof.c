@@ -0,0 +1,104 @@
+#include "hal_spi_prof.h"
+#include "ebike_hal.h"
+
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+
+struct hal_spi_prof {
+    int64_t start_us; 						// Of the transaction on the bus
+    hal_spi_prof_stats_t stats;
+};
+
+static hal_spi_prof_t records[HAL_SPI_PROF_MAX];
+static uint8_t record_count;
+static int64_t since_us;
+
+// The SPI callbacks of both cores update the counters
+#if CONFIG_IDF_TARGET_LINUX
+#define PROF_LOCK()
+#define PROF_UNLOCK()
+#else
+static portMUX_TYPE prof_lock = portMUX_INITIALIZER_UNLOCKED;
+#define PROF_LOCK()          portENTER_CRITICAL_SAFE(&prof_lock)
+#define PROF_UNLOCK()        portEXIT_CRITICAL_SAFE(&prof_lock)
+#endif
+
+hal_spi_prof_t *hal_spi_prof_register(const char *name) {
+    hal_spi_prof_t *prof = NULL;
+
+    PROF_LOCK();
+    if (record_count < HAL_SPI_PROF_MAX) {
+        if (!record_count) since_us = hal_time_us();
+        prof = &records[record_count++];
+        memset(prof, 0, sizeof(*prof));
+        prof->stats.name = name;
+    }
+    PROF_UNLOCK();
+    return prof;
+}
+
+void HAL_ISR_ATTR hal_spi_prof_begin(hal_spi_prof_t *prof) {
+    if (prof) prof->start_us = hal_time_us();
+}
+
+void HAL_ISR_ATTR hal_spi_prof_end(hal_spi_prof_t *prof, size_t bytes, bool polling) {
+    if (prof) hal_spi_prof_record(prof, bytes, hal_time_us() - prof->start_us, polling);
+}
+
+void HAL_ISR_ATTR hal_spi_prof_record(hal_spi_prof_t *prof, size_t bytes, uint32_t us, bool polling) {
+    if (!prof) return;
+
+    uint8_t bucket = us < 2 ? 0 : 31 - __builtin_clz(us);
+    if (bucket >= HAL_SPI_PROF_BUCKETS) bucket = HAL_SPI_PROF_BUCKETS - 1;
+
+    PROF_LOCK();
+    hal_spi_prof_stats_t *s = &prof->stats;
+    s->transactions++;
+    if (polling) s->polling++;
+    s->bytes += bytes;
+    s->busy_us += us;
+    if (us > s->max_us) s->max_us = us;
+    s->hist[bucket]++;
+    PROF_UNLOCK();
+}
+
+uint8_t hal_spi_prof_id(const hal_spi_prof_t *prof) {
+    return prof ? (uint8_t)(prof - records) + 1 : 0;
+}
+
+hal_spi_prof_t * HAL_ISR_ATTR hal_spi_prof_from_id(uint8_t id) {
+    return id ? &records[id - 1] : NULL;
+}
+
+size_t hal_spi_prof_get_stats(hal_spi_prof_stats_t *out, size_t max, int64_t *window_us) {
+    PROF_LOCK();
+    size_t n = record_count < max ? record_count : max;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = records[i].stats;
+    }
+    if (window_us) *window_us = hal_time_us() - since_us;
+    PROF_UNLOCK();
+    return n;
+}
+
+void hal_spi_prof_clear(void) {
+    PROF_LOCK();
+    for (uint8_t i = 0; i < record_count; i++) {
+        const char *name = records[i].stats.name;
+        memset(&records[i].stats, 0, sizeof(records[i].stats));
+        records[i].stats.name = name;
+    }
+    since_us = hal_time_us();
+    PROF_UNLOCK();
+}
+
+void hal_spi_prof_reset(void) {
+    PROF_LOCK();
+    memset(records, 0, sizeof(records));
+    record_count = 0;
+    PROF_UNLOCK();
+}
+
+#endif 				// CONFIG_EBIKE_HAL_SPI_PROFILE
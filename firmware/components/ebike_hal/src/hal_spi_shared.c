@@ -0,0 +1,118 @@
+#include "hal_spi_shared.h"
+#include <string.h>
+
+// Bus references
+
+esp_err_t hal_spi_bus_ref(hal_spi_bus_ref_t *bus, const hal_spi_bus_config_t *config) {
+    if (!bus->refs) return ESP_ERR_NOT_FOUND;
+
+    // A device that does not read may share a bus that has MISO
+    const hal_spi_bus_config_t *cur = &bus->config;
+    if (config->pin_mosi != cur->pin_mosi || config->pin_sclk != cur->pin_sclk ||
+        (config->pin_miso >= 0 && config->pin_miso != cur->pin_miso)) {
+        return ESP_ERR_INVALID_STATE;
+    }
+    bus->refs++;
+    return ESP_OK;
+}
+
+bool hal_spi_bus_unref(hal_spi_bus_ref_t *bus) {
+    if (bus->refs <= 0) return false;
+    return --bus->refs == 0;
+}
+
+// Arbitration
+
+esp_err_t hal_spi_arbiter_add(hal_spi_arbiter_t *arb, struct hal_spi_client *client,
+                              const hal_spi_client_config_t *config) {
+    if (arb->client_count >= HAL_SPI_MAX_CLIENTS) return ESP_ERR_NO_MEM;
+
+    client->arb = arb;
+    client->waiting = false;
+    memset(&client->stats, 0, sizeof(client->stats));
+    client->stats.name = config->name;
+    client->stats.priority = config->priority;
+    arb->clients[arb->client_count++] = client;
+    return ESP_OK;
+}
+
+esp_err_t hal_spi_arbiter_remove(hal_spi_arbiter_t *arb, struct hal_spi_client *client) {
+    if (arb->owner == client || client->waiting) return ESP_ERR_INVALID_STATE;
+
+    for (uint8_t i = 0; i < arb->client_count; i++) {
+        if (arb->clients[i] != client) continue;
+        memmove(&arb->clients[i], &arb->clients[i + 1], (arb->client_count - i - 1) * sizeof(arb->clients[0]));
+        arb->client_count--;
+        client->arb = NULL;
+        return ESP_OK;
+    }
+    return ESP_ERR_NOT_FOUND;
+}
+
+static void hal_spi_arbiter_grant(hal_spi_arbiter_t *arb, struct hal_spi_client *client, int64_t now_us) {
+    arb->owner = client;
+    client->since_us = now_us;
+    client->stats.holds++;
+}
+
+bool hal_spi_arbiter_request(hal_spi_arbiter_t *arb, struct hal_spi_client *client, int64_t now_us) {
+    // The bus is only free with nobody waiting: release hands it over
+    if (!arb->owner) {
+        hal_spi_arbiter_grant(arb, client, now_us);
+        return true;
+    }
+    client->waiting = true;
+    client->since_us = now_us;
+    return false;
+}
+
+struct hal_spi_client *hal_spi_arbiter_release(hal_spi_arbiter_t *arb, struct hal_spi_client *client,
+                                               int64_t now_us) {
+    if (arb->owner != client) return NULL;
+    client->stats.busy_us += now_us - client->since_us;
+    arb->owner = NULL;
+
+    // Clients are few: a scan beats keeping a sorted wait queue
+    struct hal_spi_client *next = NULL;
+    for (uint8_t i = 0; i < arb->client_count; i++) {
+        struct hal_spi_client *c = arb->clients[i];
+        if (!c->waiting) continue;
+        if (!next || c->stats.priority > next->stats.priority ||
+            (c->stats.priority == next->stats.priority && c->since_us < next->since_us)) {
+            next = c;
+        }
+    }
+    if (!next) return NULL;
+
+    uint32_t wait_us = now_us - next->since_us;
+    next->waiting = false;
+    next->stats.contended++;
+    next->stats.wait_us += wait_us;
+    if (wait_us > next->stats.max_wait_us) next->stats.max_wait_us = wait_us;
+    hal_spi_arbiter_grant(arb, next, now_us);
+    return next;
+}
+
+size_t hal_spi_arbiter_stats(const hal_spi_arbiter_t *arb, hal_spi_client_stats_t *out, size_t max,
+                             int64_t now_us, int64_t *window_us) {
+    size_t n = arb->client_count < max ? arb->client_count : max;
+    for (size_t i = 0; i < n; i++) {
+        out[i] = arb->clients[i]->stats;
+    }
+    if (window_us) *window_us = now_us - arb->stats_since_us;
+    return n;
+}
+
+void hal_spi_arbiter_clear(hal_spi_arbiter_t *arb, int64_t now_us) {
+    for (uint8_t i = 0; i < arb->client_count; i++) {
+        hal_spi_client_stats_t *s = &arb->clients[i]->stats;
+        const char *name = s->name;
+        uint8_t priority = s->priority;
+        memset(s, 0, sizeof(*s));
+        s->name = name;
+        s->priority = priority;
+    }
+    // A hold in progress only counts from here
+    if (arb->owner) arb->owner->since_us = now_us;
+    arb->stats_since_us = now_us;
+}
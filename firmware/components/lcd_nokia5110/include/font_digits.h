@@ -0,0 +1,36 @@
+#ifndef FONT_DIGITS_H
+#define FONT_DIGITS_H
+
+#include <stdint.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Digit strips for lcd_nokia5110_write_fixed_font(), generated at build
+// time by tools/gen_font_digits.py. Each glyph is a cell of width
+// columns (spacing included) by banks 8-pixel banks, stored bank by
+// bank in the framebuffer layout, so it is copied without scaling.
+enum {
+    FONT_DIGIT_POINT = 10, 				// Glyphs 0-9 are the digits
+    FONT_DIGIT_MINUS,
+    FONT_DIGIT_SPACE,
+    FONT_DIGIT_GLYPHS,
+};
+
+typedef struct {
+    uint8_t width; 					// Columns per cell
+    uint8_t banks; 					// Cell height / 8
+    const uint8_t *cells; 				// FONT_DIGIT_GLYPHS cells
+} font_digits_t;
+
+extern const font_digits_t font_digits_1x; 			// 5x7 font, 6 x 8 cells
+extern const font_digits_t font_digits_2x; 			// 12 x 16
+extern const font_digits_t font_digits_3x; 			// 18 x 24
+extern const font_digits_t font_digits_7seg; 			// 7-segment, 12 x 16
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// FONT_DIGITS_H
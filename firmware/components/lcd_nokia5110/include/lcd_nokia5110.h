@@ -0,0 +1,107 @@
+#ifndef LCD_NOKIA5110_H
+#define LCD_NOKIA5110_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+#include "font_digits.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Opaque type for encapsulation
+typedef struct lcd_nokia5110_priv_t *lcd_nokia5110_t;				// Opaque pointer
+
+// Display controller. Both are monochrome with the same framebuffer
+// layout (banks of 8 pixel rows, one byte per column), so everything
+// above init only sees a different size.
+typedef enum {
+    LCD_NOKIA5110_PANEL_PCD8544 = 0, 			// Nokia 5110, 84x48 on SPI
+    LCD_NOKIA5110_PANEL_SSD1306, 			// OLED, 128x64 or 128x32 on I2C
+} lcd_nokia5110_panel_t;
+
+// Initialization configuration
+typedef struct {
+    lcd_nokia5110_panel_t panel;
+    // PCD8544
+    int pin_sclk; 					// Pin CLK SPI
+    int pin_din; 					// Pin MOSI SPI
+    int pin_dc; 					// Pin Data/Command
+    int pin_cs; 					// Pin Chip Select
+    int pin_rst; 					// Pin Reset
+    int spi_host; 					// SPI port (1 = SPI2, 2 = SPI3)
+    uint8_t bus_priority; 				// Arbitration priority on a shared host, 0 if not shared
+    // SSD1306
+    int i2c_port;
+    int pin_sda;
+    int pin_scl;
+    uint8_t i2c_addr; 					// 0 selects 0x3C
+    uint8_t height; 					// 32 or 64, 0 selects 64
+    int clock_hz; 					// 0 selects 4 MHz SPI, 400 kHz I2C
+    uint8_t contrast; 					// Contrast level (0-0x7F)
+} lcd_nokia5110_config_t;
+
+// Bus statistics
+typedef struct {
+    uint32_t frames; 					// Calls to lcd_nokia5110_update()
+    uint32_t flushes; 					// Bus flushes (back-to-back frames coalesce)
+    uint32_t transactions; 				// Bus transactions sent
+    uint32_t bytes; 					// Bytes sent, commands included
+    uint32_t last_update_us; 				// Caller time in the last update
+    uint32_t max_update_us;
+    uint32_t last_flush_us; 				// Bus time of the last flush
+    uint32_t max_flush_us;
+    uint32_t busy_us; 					// Total bus time, wraps
+} lcd_nokia5110_stats_t;
+
+// Public functions
+esp_err_t lcd_nokia5110_init(const lcd_nokia5110_config_t *config, lcd_nokia5110_t *lcd);
+void lcd_nokia5110_deinit(lcd_nokia5110_t lcd);
+
+// Display control
+void lcd_nokia5110_clear(lcd_nokia5110_t lcd);
+// Hand the dirty spans to the flush. With CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+// the flush task sends them and this returns without waiting on the bus.
+void lcd_nokia5110_update(lcd_nokia5110_t lcd);
+void lcd_nokia5110_invalidate(lcd_nokia5110_t lcd); 			// Next update sends the whole frame
+void lcd_nokia5110_set_contrast(lcd_nokia5110_t lcd, uint8_t contrast);
+void lcd_nokia5110_invert(lcd_nokia5110_t lcd, bool invert);
+// Power-down (PCD8544) or display off with the charge pump off (SSD1306).
+// Display RAM is kept, and drawing and update still work while asleep.
+void lcd_nokia5110_sleep(lcd_nokia5110_t lcd, bool sleep);
+// Panel size in pixels
+void lcd_nokia5110_get_size(lcd_nokia5110_t lcd, uint8_t *width, uint8_t *height);
+
+// Statistics
+void lcd_nokia5110_get_stats(lcd_nokia5110_t lcd, lcd_nokia5110_stats_t *stats);
+void lcd_nokia5110_clear_stats(lcd_nokia5110_t lcd);
+
+// Text functions
+void lcd_nokia5110_set_cursor(lcd_nokia5110_t lcd, uint8_t x, uint8_t y);
+void lcd_nokia5110_write_char(lcd_nokia5110_t lcd, char c);
+void lcd_nokia5110_write_string(lcd_nokia5110_t lcd, const char *str);
+
+// Fixed-point number value / 10^decimals at the cursor, without libc
+// formatting. With width != 0 it is right aligned in width characters,
+// and shown as dashes if it does not fit. Leading zeros are blank unless
+// LCD_NOKIA5110_NUM_ZERO_PAD is set.
+#define LCD_NOKIA5110_NUM_ZERO_PAD   0x01
+void lcd_nokia5110_write_fixed(lcd_nokia5110_t lcd, int32_t value, uint8_t decimals, uint8_t width, uint8_t flags);
+// Same with a large digit font; the cursor row is the top bank
+void lcd_nokia5110_write_fixed_font(lcd_nokia5110_t lcd, const font_digits_t *font, int32_t value,
+                                    uint8_t decimals, uint8_t width, uint8_t flags);
+
+// Graphic functions. They only touch the framebuffer; call update to send.
+// Bitmaps use the framebuffer layout: (h + 7) / 8 banks of w bytes, one
+// byte per 8-pixel column, bit 0 on top. A bitmap replaces its w x h box.
+void lcd_nokia5110_draw_pixel(lcd_nokia5110_t lcd, uint8_t x, uint8_t y, bool on);
+void lcd_nokia5110_draw_line(lcd_nokia5110_t lcd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool on);
+void lcd_nokia5110_draw_rect(lcd_nokia5110_t lcd, uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool fill, bool on);
+void lcd_nokia5110_draw_bitmap(lcd_nokia5110_t lcd, uint8_t x, uint8_t y, const uint8_t *bitmap, uint8_t w, uint8_t h);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// LCD_NOKIA5110_H
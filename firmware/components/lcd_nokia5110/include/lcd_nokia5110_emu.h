@@ -0,0 +1,86 @@
+#ifndef LCD_NOKIA5110_EMU_H
+#define LCD_NOKIA5110_EMU_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// PCD8544 emulator for the linux target. It sits on the HAL mock SPI bus
+// (hal_mock_spi_set_hook), follows the address and display control
+// commands and stores data bytes with horizontal auto-increment, so ram
+// is what the glass would show after the real driver path ran.
+
+#define LCD_NOKIA5110_EMU_WIDTH  84
+#define LCD_NOKIA5110_EMU_BANKS  6
+#define LCD_NOKIA5110_EMU_HEIGHT (LCD_NOKIA5110_EMU_BANKS * 8)
+
+typedef struct {
+    uint8_t ram[LCD_NOKIA5110_EMU_BANKS][LCD_NOKIA5110_EMU_WIDTH];
+    uint8_t x;
+    uint8_t y;
+    bool extended; 					// H bit of the last function set
+    bool power_down; 					// PD bit of the last function set
+    uint8_t display_mode; 				// D and E bits of display control
+    uint8_t last_cmd;
+    int dc_pin;
+    uint32_t cmd_transactions;
+    uint32_t data_transactions;
+    uint32_t cmd_bytes;
+    uint32_t data_bytes;
+} lcd_nokia5110_emu_t;
+
+// Install the emulator as the mock SPI hook (clears it)
+void lcd_nokia5110_emu_attach(lcd_nokia5110_emu_t *emu, int dc_pin);
+void lcd_nokia5110_emu_clear_counts(lcd_nokia5110_emu_t *emu);
+void lcd_nokia5110_emu_detach(void);
+
+// Visible pixel, power-down and display mode (blank, all on, inverse)
+// applied
+bool lcd_nokia5110_emu_pixel(const lcd_nokia5110_emu_t *emu, int x, int y);
+
+// Write the visible frame as a binary PBM (P4) image
+esp_err_t lcd_nokia5110_emu_write_pbm(const lcd_nokia5110_emu_t *emu, const char *path);
+
+// SSD1306 emulator on the HAL mock I2C bus (hal_mock_i2c_set_hook). It
+// parses the control byte and command stream, and stores data through the
+// column and page address window in horizontal addressing mode. The
+// visible height follows the multiplex ratio.
+
+#define LCD_NOKIA5110_SSD1306_EMU_WIDTH  128
+#define LCD_NOKIA5110_SSD1306_EMU_PAGES  8
+
+typedef struct {
+    uint8_t ram[LCD_NOKIA5110_SSD1306_EMU_PAGES][LCD_NOKIA5110_SSD1306_EMU_WIDTH];
+    uint8_t col;
+    uint8_t page;
+    uint8_t col_start, col_end; 			// Address window, inclusive
+    uint8_t page_start, page_end;
+    uint8_t height; 					// Multiplex ratio + 1
+    uint8_t contrast;
+    bool on; 						// Display on (AF)
+    bool inverse;
+    bool entire_on;
+    uint8_t cmd[3]; 					// Command being assembled
+    uint8_t cmd_len;
+    uint32_t cmd_transactions;
+    uint32_t data_transactions;
+    uint32_t cmd_bytes; 				// Control bytes included
+    uint32_t data_bytes;
+} lcd_nokia5110_ssd1306_emu_t;
+
+// Install the emulator as the mock I2C hook (clears it)
+void lcd_nokia5110_ssd1306_emu_attach(lcd_nokia5110_ssd1306_emu_t *emu);
+void lcd_nokia5110_ssd1306_emu_clear_counts(lcd_nokia5110_ssd1306_emu_t *emu);
+void lcd_nokia5110_ssd1306_emu_detach(void);
+bool lcd_nokia5110_ssd1306_emu_pixel(const lcd_nokia5110_ssd1306_emu_t *emu, int x, int y);
+esp_err_t lcd_nokia5110_ssd1306_emu_write_pbm(const lcd_nokia5110_ssd1306_emu_t *emu, const char *path);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// LCD_NOKIA5110_EMU_H
@@ -0,0 +1,138 @@
+#ifndef LCD_NOKIA5110_PRIV_H
+#define LCD_NOKIA5110_PRIV_H
+
+#include "sdkconfig.h"
+#include "lcd_nokia5110.h"
+#include "ebike_hal.h"
+#include "font_5x7.h"
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#endif
+
+// Framebuffer limits. The panel sets the actual size at init: 84 x 6
+// banks for the PCD8544, 128 x 4 or 8 banks for the SSD1306.
+#define LCD_MAX_WIDTH        128
+#define LCD_MAX_ROWS         8 					// Banks of 8 pixel rows
+#define LCD_BUFFER_SIZE     (LCD_MAX_WIDTH * LCD_MAX_ROWS)
+
+#define LCD_MAX_CMDS         32 				// Staged controller commands
+
+// Column span [x0, x1) of one bank. Clean when x0 >= x1, so marking is
+// just a min/max.
+typedef struct {
+    uint8_t x0;
+    uint8_t x1;
+} lcd_span_t;
+
+#define LCD_SPAN_CLEAN       ((lcd_span_t) { LCD_MAX_WIDTH, 0 })
+
+typedef struct lcd_nokia5110_priv_t lcd_nokia5110_priv_t;
+
+// Panel backend. The framebuffer, dirty tracking and drawing are shared;
+// a backend only knows its bus and controller commands.
+typedef struct {
+    // Bring up the bus, set width and rows and stage the init commands.
+    // Cleans up after itself on failure.
+    esp_err_t (*init)(lcd_nokia5110_priv_t *lcd, const lcd_nokia5110_config_t *config);
+    // Send the staged commands, then the spans of the front buffer, and
+    // return once they are on the wire
+    void (*send)(lcd_nokia5110_priv_t *lcd, const uint8_t *cmds, size_t cmd_len, const lcd_span_t *spans);
+    // Stage the commands for contrast (0-0x7F) and inverse video
+    void (*set_contrast)(lcd_nokia5110_priv_t *lcd, uint8_t contrast);
+    void (*invert)(lcd_nokia5110_priv_t *lcd, bool invert);
+    void (*sleep)(lcd_nokia5110_priv_t *lcd, bool sleep);
+    // Release the bus
+    void (*deinit)(lcd_nokia5110_priv_t *lcd);
+} lcd_panel_ops_t;
+
+extern const lcd_panel_ops_t lcd_panel_pcd8544;
+extern const lcd_panel_ops_t lcd_panel_ssd1306;
+
+// Complete internal structure of the LCD
+struct lcd_nokia5110_priv_t {
+    const lcd_panel_ops_t *panel;
+    uint8_t width; 						// Columns
+    uint8_t rows; 						// Banks
+    // PCD8544 on SPI
+    hal_spi_dev_t spi_dev; 					// SPI device
+    int spi_host;						// SPI host
+    hal_spi_client_t bus_client; 				// Shared host arbitration, NULL if not shared
+    int pin_dc; 						// Pin Data/Command
+    int pin_reset; 						// Pin Reset
+    int pin_cs; 						// Pin Chip Select (SPI)
+    // SSD1306 on I2C
+    hal_i2c_dev_t i2c_dev;
+    int i2c_port;
+    void *i2c_tx; 						// Transaction buffer, control byte + frame
+    uint8_t contrast; 						// Contrast level (0-0x7F)
+    uint8_t x_pos; 						// Current X position
+    uint8_t y_pos; 						// Current Y position
+    // Back buffer, written by the drawing calls: rows banks of width
+    // bytes, back to back, in the horizontal addressing order of both
+    // controllers. Use lcd_back_row().
+    uint8_t framebuffer[LCD_BUFFER_SIZE]; 			// Screen buffer
+    // Front buffer, streamed by the flush. update() copies the dirty spans
+    // over, so drawing never touches memory the DMA is reading. Word
+    // aligned so the SPI driver can DMA it in place.
+    uint8_t front[LCD_BUFFER_SIZE] __attribute__((aligned(4)));
+    bool inverted; 						// Inverted display mode
+    bool asleep; 						// Power-down
+    lcd_span_t dirty[LCD_MAX_ROWS]; 				// Back buffer changes since the last update
+    lcd_span_t pending[LCD_MAX_ROWS]; 				// Front buffer bytes not yet sent
+    uint8_t cmds[LCD_MAX_CMDS]; 				// Commands for the next flush
+    uint8_t cmd_len;
+    lcd_nokia5110_stats_t stats;
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+    portMUX_TYPE lock; 						// Guards front/pending/cmds handoff
+    TaskHandle_t flush_task;
+    volatile bool flushing;
+#endif
+};
+
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+#define LCD_LOCK(lcd)        portENTER_CRITICAL(&(lcd)->lock)
+#define LCD_UNLOCK(lcd)      portEXIT_CRITICAL(&(lcd)->lock)
+#else
+#define LCD_LOCK(lcd)        do { } while (0)
+#define LCD_UNLOCK(lcd)      do { } while (0)
+#endif
+
+static inline uint8_t *lcd_back_row(lcd_nokia5110_priv_t *lcd, uint8_t row) {
+    return &lcd->framebuffer[row * lcd->width];
+}
+
+static inline uint8_t *lcd_front_row(lcd_nokia5110_priv_t *lcd, uint8_t row) {
+    return &lcd->front[row * lcd->width];
+}
+
+static inline void lcd_mark_dirty(lcd_nokia5110_priv_t *lcd, uint8_t row, uint8_t x0, uint8_t x1) {
+    lcd_span_t *span = &lcd->dirty[row];
+    if (x0 < span->x0) span->x0 = x0;
+    if (x1 > span->x1) span->x1 = x1;
+}
+
+// Store one framebuffer byte. Rewriting the same value does not dirty it,
+// so redrawing unchanged content costs no bus time.
+static inline void lcd_put_byte(lcd_nokia5110_priv_t *lcd, uint8_t row, uint8_t x, uint8_t value) {
+    uint8_t *byte = &lcd_back_row(lcd, row)[x];
+    if (*byte == value) return;
+    *byte = value;
+    lcd_mark_dirty(lcd, row, x, x + 1);
+}
+
+// Internal function prototypes
+// Stage controller commands for the next flush. The panel backends stage,
+// the public calls kick the flush afterwards.
+void lcd_stage_commands(lcd_nokia5110_priv_t *lcd, const uint8_t *cmds, size_t len);
+// Count one bus transaction in the stats; for the panel backends
+static inline void lcd_count_transfer(lcd_nokia5110_priv_t *lcd, size_t len) {
+    lcd->stats.transactions++;
+    lcd->stats.bytes += len;
+}
+// Send columns x_start..x_end of banks y_start..y_end (inclusive),
+// whether dirty or not
+void lcd_update_region(lcd_nokia5110_priv_t *lcd, uint8_t x_start, uint8_t y_start, 
+                      uint8_t x_end, uint8_t y_end);
+
+#endif 				// LCD_NOKIA5110_PRIV_H
@@ -0,0 +1,305 @@
+#include "lcd_nokia5110.h"
+#include "lcd_nokia5110_priv.h"
+#include <stdlib.h>
+#include <string.h>
+#include "font_5x7.h"
+#include "esp_log.h"
+
+static const char *TAG = "NOKIA5110";
+
+static void lcd_flush(lcd_nokia5110_priv_t *lcd);
+
+// Hand the staged work to the flush task, or send it right away
+static void lcd_kick(lcd_nokia5110_priv_t *lcd) {
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+    if (lcd->flush_task) {
+        xTaskNotifyGive(lcd->flush_task);
+        return;
+    }
+#endif
+    lcd_flush(lcd);
+}
+
+void lcd_stage_commands(lcd_nokia5110_priv_t *lcd, const uint8_t *cmds, size_t len) {
+    LCD_LOCK(lcd);
+    // Only overflows if the flush is stuck; the bus is no use then anyway
+    if (lcd->cmd_len + len <= sizeof(lcd->cmds)) {
+        memcpy(&lcd->cmds[lcd->cmd_len], cmds, len);
+        lcd->cmd_len += len;
+    }
+    LCD_UNLOCK(lcd);
+}
+
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+static bool lcd_busy(lcd_nokia5110_priv_t *lcd) {
+    bool busy = lcd->flushing || lcd->cmd_len;
+    for (uint8_t row = 0; row < lcd->rows; row++) {
+        busy |= lcd->pending[row].x0 < lcd->pending[row].x1;
+    }
+    return busy;
+}
+
+static void lcd_flush_task(void *arg) {
+    lcd_nokia5110_priv_t *lcd = arg;
+    while (1) {
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+        lcd->flushing = true;
+        lcd_flush(lcd);
+        lcd->flushing = false;
+    }
+}
+#endif
+
+// LCD initialization
+esp_err_t lcd_nokia5110_init(const lcd_nokia5110_config_t *config, lcd_nokia5110_t *lcd) {
+    esp_err_t ret;
+    lcd_nokia5110_priv_t *priv = calloc(1, sizeof(lcd_nokia5110_priv_t));
+    if (!priv) return ESP_ERR_NO_MEM;
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+    // Before panel->init(): staging its commands already takes the lock
+    portMUX_INITIALIZE(&priv->lock);
+#endif
+
+    switch (config->panel) {
+    case LCD_NOKIA5110_PANEL_PCD8544: priv->panel = &lcd_panel_pcd8544; break;
+    case LCD_NOKIA5110_PANEL_SSD1306: priv->panel = &lcd_panel_ssd1306; break;
+    default:
+        free(priv);
+        return ESP_ERR_INVALID_ARG;
+    }
+    priv->contrast = config->contrast;
+    priv->inverted = false;
+
+    // Bus, size and the controller init commands
+    ret = priv->panel->init(priv, config);
+    if (ret != ESP_OK) {
+        free(priv);
+        return ret;
+    }
+
+    // Clear screen. Display RAM is undefined after reset, so push every byte.
+    // The flush task does not exist yet, so this runs inline.
+    for (uint8_t row = 0; row < LCD_MAX_ROWS; row++) {
+        priv->pending[row] = LCD_SPAN_CLEAN;
+    }
+    lcd_nokia5110_invalidate((lcd_nokia5110_t)priv);
+    lcd_nokia5110_update((lcd_nokia5110_t)priv);
+    lcd_nokia5110_clear_stats((lcd_nokia5110_t)priv);
+
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+    if (xTaskCreate(lcd_flush_task, "lcd_flush", 2560, priv, CONFIG_LCD_NOKIA5110_FLUSH_TASK_PRIORITY,
+                    &priv->flush_task) != pdPASS) {
+        priv->panel->deinit(priv);
+        free(priv);
+        return ESP_ERR_NO_MEM;
+    }
+#endif
+
+    *lcd = (lcd_nokia5110_t)priv;
+    ESP_LOGI(TAG, "LCD initialized successfully");
+    return ESP_OK;
+}
+
+// Implementation of public functions
+
+void lcd_nokia5110_clear(lcd_nokia5110_t lcd) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+    for (uint8_t row = 0; row < priv->rows; row++) {
+        for (uint8_t x = 0; x < priv->width; x++) {
+            lcd_put_byte(priv, row, x, 0x00);
+        }
+    }
+    priv->x_pos = 0;
+    priv->y_pos = 0;
+}
+
+void lcd_nokia5110_write_char(lcd_nokia5110_t lcd, char c) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+    
+    if (priv->y_pos >= priv->rows) return;
+    if ((unsigned char)c < 32 || (unsigned char)c > 127) c = ' ';
+
+    for (uint8_t i = 0; i < 5; i++) {
+        if (priv->x_pos < priv->width) {
+            uint8_t col = font_5x7[c - 32][i];
+            lcd_put_byte(priv, priv->y_pos, priv->x_pos, col);
+            priv->x_pos++;
+        }
+    }
+    
+    // Space between characters
+    if (priv->x_pos < priv->width) {
+        lcd_put_byte(priv, priv->y_pos, priv->x_pos, 0x00);
+        priv->x_pos++;
+    }
+}
+
+void lcd_nokia5110_write_string(lcd_nokia5110_t lcd, const char *str) {
+	while (*str) {
+		lcd_nokia5110_write_char(lcd, *str++);
+	}
+}
+
+void lcd_nokia5110_set_cursor(lcd_nokia5110_t lcd, uint8_t x, uint8_t y) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	priv->x_pos = x;
+	priv->y_pos = y;
+}
+
+// Send the staged commands and pending front buffer bytes, until update()
+// stops adding more. Runs in the flush task, or inline without
+// CONFIG_LCD_NOKIA5110_ASYNC_FLUSH. The front buffer may be refreshed
+// while the DMA reads it; the bytes are pending again then, so the panel
+// ends up with the last frame either way.
+static void lcd_flush(lcd_nokia5110_priv_t *lcd) {
+	while (1) {
+		uint8_t cmds[LCD_MAX_CMDS];
+		lcd_span_t spans[LCD_MAX_ROWS];
+		bool any = false;
+
+		LCD_LOCK(lcd);
+		size_t cmd_len = lcd->cmd_len;
+		memcpy(cmds, lcd->cmds, cmd_len);
+		lcd->cmd_len = 0;
+		for (uint8_t row = 0; row < lcd->rows; row++) {
+			spans[row] = lcd->pending[row];
+			any |= spans[row].x0 < spans[row].x1;
+			lcd->pending[row] = LCD_SPAN_CLEAN;
+		}
+		LCD_UNLOCK(lcd);
+		if (!cmd_len && !any) return;
+
+		int64_t start = hal_time_us();
+		lcd->panel->send(lcd, cmds, cmd_len, spans);
+		uint32_t elapsed = (uint32_t)(hal_time_us() - start);
+
+		lcd->stats.flushes++;
+		lcd->stats.last_flush_us = elapsed;
+		lcd->stats.busy_us += elapsed;
+		if (elapsed > lcd->stats.max_flush_us) lcd->stats.max_flush_us = elapsed;
+	}
+}
+
+// Copy spans of the back buffer to the front buffer and mark them
+// pending. A memcpy under the lock is all the caller pays.
+static bool lcd_publish(lcd_nokia5110_priv_t *lcd, const lcd_span_t spans[LCD_MAX_ROWS]) {
+	bool any = false;
+	LCD_LOCK(lcd);
+	for (uint8_t row = 0; row < lcd->rows; row++) {
+		lcd_span_t span = spans[row];
+		if (span.x0 >= span.x1) continue;
+
+		memcpy(&lcd_front_row(lcd, row)[span.x0], &lcd_back_row(lcd, row)[span.x0], span.x1 - span.x0);
+		lcd_span_t *pending = &lcd->pending[row];
+		if (span.x0 < pending->x0) pending->x0 = span.x0;
+		if (span.x1 > pending->x1) pending->x1 = span.x1;
+		any = true;
+	}
+	LCD_UNLOCK(lcd);
+	return any;
+}
+
+void lcd_nokia5110_update(lcd_nokia5110_t lcd) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+
+	int64_t start = hal_time_us();
+	// A clean frame does not even wake the flush task
+	if (lcd_publish(priv, priv->dirty)) {
+		for (uint8_t row = 0; row < priv->rows; row++) {
+			priv->dirty[row] = LCD_SPAN_CLEAN;
+		}
+		lcd_kick(priv);
+	}
+	uint32_t elapsed = (uint32_t)(hal_time_us() - start);
+
+	priv->stats.frames++;
+	priv->stats.last_update_us = elapsed;
+	if (elapsed > priv->stats.max_update_us) priv->stats.max_update_us = elapsed;
+}
+
+void lcd_nokia5110_invalidate(lcd_nokia5110_t lcd) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	for (uint8_t row = 0; row < priv->rows; row++) {
+		priv->dirty[row] = (lcd_span_t) { 0, priv->width };
+	}
+}
+
+void lcd_update_region(lcd_nokia5110_priv_t *lcd, uint8_t x_start, uint8_t y_start,
+                      uint8_t x_end, uint8_t y_end) {
+	if (x_end >= lcd->width) x_end = lcd->width - 1;
+	if (y_end >= lcd->rows) y_end = lcd->rows - 1;
+	if (x_start > x_end || y_start > y_end) return;
+
+	lcd_span_t spans[LCD_MAX_ROWS];
+	for (uint8_t row = 0; row < lcd->rows; row++) {
+		spans[row] = LCD_SPAN_CLEAN;
+		if (row < y_start || row > y_end) continue;
+
+		spans[row] = (lcd_span_t) { x_start, x_end + 1 };
+		// A dirty span inside the region goes out with it
+		lcd_span_t *dirty = &lcd->dirty[row];
+		if (dirty->x0 >= x_start && dirty->x1 <= x_end + 1) {
+			*dirty = LCD_SPAN_CLEAN;
+		}
+	}
+	lcd_publish(lcd, spans);
+	lcd_kick(lcd);
+}
+
+void lcd_nokia5110_get_stats(lcd_nokia5110_t lcd, lcd_nokia5110_stats_t *stats) {
+	*stats = ((lcd_nokia5110_priv_t *)lcd)->stats;
+}
+
+void lcd_nokia5110_clear_stats(lcd_nokia5110_t lcd) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	memset(&priv->stats, 0, sizeof(priv->stats));
+}
+
+void lcd_nokia5110_set_contrast(lcd_nokia5110_t lcd, uint8_t contrast) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	priv->contrast = contrast;
+	priv->panel->set_contrast(priv, contrast);
+	lcd_kick(priv);
+}
+
+// Inverse video in the controller, the framebuffer is left alone
+void lcd_nokia5110_invert(lcd_nokia5110_t lcd, bool invert) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	priv->inverted = invert;
+	priv->panel->invert(priv, invert);
+	lcd_kick(priv);
+}
+
+void lcd_nokia5110_sleep(lcd_nokia5110_t lcd, bool sleep) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	if (priv->asleep == sleep) return;
+	priv->asleep = sleep;
+	priv->panel->sleep(priv, sleep);
+	lcd_kick(priv);
+}
+
+void lcd_nokia5110_get_size(lcd_nokia5110_t lcd, uint8_t *width, uint8_t *height) {
+	lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+	*width = priv->width;
+	*height = priv->rows * 8;
+}
+
+void lcd_nokia5110_deinit(lcd_nokia5110_t lcd) {
+	if (lcd) {
+		lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+		// 0. Let the last frame out, then stop the flush task
+		while (lcd_busy(priv)) {
+			vTaskDelay(1);
+		}
+		vTaskDelete(priv->flush_task);
+#endif
+
+		// 1. Release the panel's device and bus
+		priv->panel->deinit(priv);
+
+		// 2. Free memory
+		free(priv);
+	}
+}
@@ -0,0 +1,207 @@
+#include "lcd_nokia5110_emu.h"
+#include <stdio.h>
+#include <string.h>
+#include "ebike_hal_mock.h"
+
+#define EMU_MODE_D           0x04
+#define EMU_MODE_E           0x01
+
+// Commands of both instruction sets; only the ones that move the
+// address or change what is shown matter
+static void emu_command(lcd_nokia5110_emu_t *emu, uint8_t cmd) {
+    emu->last_cmd = cmd;
+    if ((cmd & 0xF8) == 0x20) {
+        emu->extended = cmd & 0x01;
+        emu->power_down = cmd & 0x04;
+    } else if (emu->extended) {
+        return;
+    } else if (cmd & 0x80) {
+        emu->x = cmd & 0x7F;
+    } else if ((cmd & 0xF8) == 0x40) {
+        emu->y = cmd & 0x07;
+    } else if ((cmd & 0xFA) == 0x08) {
+        emu->display_mode = cmd & (EMU_MODE_D | EMU_MODE_E);
+    }
+}
+
+// Horizontal addressing: X wraps into the next bank, the last bank
+// wraps to the top
+static void emu_data(lcd_nokia5110_emu_t *emu, uint8_t data) {
+    if (emu->x < LCD_NOKIA5110_EMU_WIDTH && emu->y < LCD_NOKIA5110_EMU_BANKS) {
+        emu->ram[emu->y][emu->x] = data;
+    }
+    if (++emu->x >= LCD_NOKIA5110_EMU_WIDTH) {
+        emu->x = 0;
+        emu->y = (emu->y + 1) % LCD_NOKIA5110_EMU_BANKS;
+    }
+}
+
+static void emu_hook(hal_spi_dev_t dev, const uint8_t *data, size_t len, void *ctx) {
+    lcd_nokia5110_emu_t *emu = ctx;
+
+    if (!hal_mock_dio_get(emu->dc_pin)) {
+        emu->cmd_transactions++;
+        emu->cmd_bytes += len;
+        for (size_t i = 0; i < len; i++) emu_command(emu, data[i]);
+        return;
+    }
+    emu->data_transactions++;
+    emu->data_bytes += len;
+    for (size_t i = 0; i < len; i++) emu_data(emu, data[i]);
+}
+
+void lcd_nokia5110_emu_attach(lcd_nokia5110_emu_t *emu, int dc_pin) {
+    memset(emu, 0, sizeof(*emu));
+    emu->dc_pin = dc_pin;
+    hal_mock_spi_set_hook(emu_hook, emu);
+}
+
+void lcd_nokia5110_emu_clear_counts(lcd_nokia5110_emu_t *emu) {
+    emu->cmd_transactions = 0;
+    emu->data_transactions = 0;
+    emu->cmd_bytes = 0;
+    emu->data_bytes = 0;
+}
+
+void lcd_nokia5110_emu_detach(void) {
+    hal_mock_spi_set_hook(NULL, NULL);
+}
+
+bool lcd_nokia5110_emu_pixel(const lcd_nokia5110_emu_t *emu, int x, int y) {
+    if (x < 0 || x >= LCD_NOKIA5110_EMU_WIDTH || y < 0 || y >= LCD_NOKIA5110_EMU_HEIGHT) return false;
+
+    if (emu->power_down) return false;
+
+    bool on = (emu->ram[y / 8][x] >> (y & 7)) & 1;
+    switch (emu->display_mode) {
+    case 0: return false; 					// Blank
+    case EMU_MODE_E: return true; 				// All segments on
+    case EMU_MODE_D | EMU_MODE_E: return !on; 			// Inverse video
+    default: return on;
+    }
+}
+
+typedef bool (*emu_pixel_fn_t)(const void *emu, int x, int y);
+
+// P4: one bit per pixel, rows padded to whole bytes, MSB first, 1 = black
+static esp_err_t emu_write_pbm(const void *emu, emu_pixel_fn_t pixel, int width, int height, const char *path) {
+    FILE *f = fopen(path, "wb");
+    if (!f) return ESP_FAIL;
+
+    fprintf(f, "P4\n%d %d\n", width, height);
+    for (int y = 0; y < height; y++) {
+        uint8_t row[(LCD_NOKIA5110_SSD1306_EMU_WIDTH + 7) / 8] = { 0 };
+        for (int x = 0; x < width; x++) {
+            if (pixel(emu, x, y)) row[x / 8] |= 0x80 >> (x & 7);
+        }
+        fwrite(row, 1, (width + 7) / 8, f);
+    }
+    return fclose(f) == 0 ? ESP_OK : ESP_FAIL;
+}
+
+static bool emu_pixel(const void *emu, int x, int y) {
+    return lcd_nokia5110_emu_pixel(emu, x, y);
+}
+
+esp_err_t lcd_nokia5110_emu_write_pbm(const lcd_nokia5110_emu_t *emu, const char *path) {
+    return emu_write_pbm(emu, emu_pixel, LCD_NOKIA5110_EMU_WIDTH, LCD_NOKIA5110_EMU_HEIGHT, path);
+}
+
+// SSD1306
+
+// Argument bytes of the commands the driver uses; the rest take none
+static uint8_t ssd1306_emu_args(uint8_t cmd) {
+    switch (cmd) {
+    case 0x21: case 0x22: return 2; 				// Column, page address
+    case 0x20: case 0x81: case 0x8D: case 0xA8: case 0xD3:
+    case 0xD5: case 0xD9: case 0xDA: case 0xDB: return 1;
+    default: return 0;
+    }
+}
+
+static void ssd1306_emu_command(lcd_nokia5110_ssd1306_emu_t *emu, uint8_t byte) {
+    emu->cmd[emu->cmd_len++] = byte;
+    if (emu->cmd_len <= ssd1306_emu_args(emu->cmd[0])) return;
+    emu->cmd_len = 0;
+
+    const uint8_t *c = emu->cmd;
+    switch (c[0]) {
+    case 0x21:
+        emu->col_start = emu->col = c[1] & 0x7F;
+        emu->col_end = c[2] & 0x7F;
+        break;
+    case 0x22:
+        emu->page_start = emu->page = c[1] & 0x07;
+        emu->page_end = c[2] & 0x07;
+        break;
+    case 0x81: emu->contrast = c[1]; break;
+    case 0xA8: emu->height = (c[1] & 0x3F) + 1; break;
+    case 0xA4: case 0xA5: emu->entire_on = c[0] & 1; break;
+    case 0xA6: case 0xA7: emu->inverse = c[0] & 1; break;
+    case 0xAE: case 0xAF: emu->on = c[0] & 1; break;
+    default: break;
+    }
+}
+
+// Horizontal addressing: the column wraps to col_start of the next page
+// of the window, the last page wraps to page_start
+static void ssd1306_emu_data(lcd_nokia5110_ssd1306_emu_t *emu, uint8_t data) {
+    emu->ram[emu->page][emu->col] = data;
+    if (emu->col++ < emu->col_end) return;
+    emu->col = emu->col_start;
+    emu->page = emu->page < emu->page_end ? emu->page + 1 : emu->page_start;
+}
+
+static void ssd1306_emu_hook(hal_i2c_dev_t dev, const uint8_t *data, size_t len, void *ctx) {
+    lcd_nokia5110_ssd1306_emu_t *emu = ctx;
+    if (!len) return;
+
+    // The driver only sends streams (Co = 0); D/C# picks the kind
+    if (data[0] & 0x40) {
+        emu->data_transactions++;
+        emu->data_bytes += len;
+        for (size_t i = 1; i < len; i++) ssd1306_emu_data(emu, data[i]);
+        return;
+    }
+    emu->cmd_transactions++;
+    emu->cmd_bytes += len;
+    for (size_t i = 1; i < len; i++) ssd1306_emu_command(emu, data[i]);
+}
+
+void lcd_nokia5110_ssd1306_emu_attach(lcd_nokia5110_ssd1306_emu_t *emu) {
+    memset(emu, 0, sizeof(*emu));
+    // Reset state
+    emu->col_end = LCD_NOKIA5110_SSD1306_EMU_WIDTH - 1;
+    emu->page_end = LCD_NOKIA5110_SSD1306_EMU_PAGES - 1;
+    emu->height = 64;
+    emu->contrast = 0x7F;
+    hal_mock_i2c_set_hook(ssd1306_emu_hook, emu);
+}
+
+void lcd_nokia5110_ssd1306_emu_clear_counts(lcd_nokia5110_ssd1306_emu_t *emu) {
+    emu->cmd_transactions = 0;
+    emu->data_transactions = 0;
+    emu->cmd_bytes = 0;
+    emu->data_bytes = 0;
+}
+
+void lcd_nokia5110_ssd1306_emu_detach(void) {
+    hal_mock_i2c_set_hook(NULL, NULL);
+}
+
+bool lcd_nokia5110_ssd1306_emu_pixel(const lcd_nokia5110_ssd1306_emu_t *emu, int x, int y) {
+    if (x < 0 || x >= LCD_NOKIA5110_SSD1306_EMU_WIDTH || y < 0 || y >= emu->height) return false;
+    if (!emu->on) return false;
+    if (emu->entire_on) return true;
+
+    bool on = (emu->ram[y / 8][x] >> (y & 7)) & 1;
+    return on != emu->inverse;
+}
+
+static bool ssd1306_emu_pixel(const void *emu, int x, int y) {
+    return lcd_nokia5110_ssd1306_emu_pixel(emu, x, y);
+}
+
+esp_err_t lcd_nokia5110_ssd1306_emu_write_pbm(const lcd_nokia5110_ssd1306_emu_t *emu, const char *path) {
+    return emu_write_pbm(emu, ssd1306_emu_pixel, LCD_NOKIA5110_SSD1306_EMU_WIDTH, emu->height, path);
+}
@@ -0,0 +1,121 @@
+#include "lcd_nokia5110.h"
+#include "lcd_nokia5110_priv.h"
+#include <stdlib.h>
+
+// Graphics on the vertical-byte framebuffer: lcd_back_row(bank)[x] holds
+// pixels y = 8 * bank .. 8 * bank + 7, bit 0 on top. Everything that can
+// is done as one masked byte write per bank and column.
+
+static inline void lcd_apply_mask(lcd_nokia5110_priv_t *lcd, uint8_t row, uint8_t x, uint8_t mask, bool on) {
+    uint8_t old = lcd_back_row(lcd, row)[x];
+    lcd_put_byte(lcd, row, x, on ? (old | mask) : (old & ~mask));
+}
+
+// Bits of bank row covered by pixel rows y0..y1
+static inline uint8_t lcd_bank_mask(int row, int y0, int y1) {
+    int lo = y0 - row * 8;
+    int hi = y1 - row * 8;
+    if (lo < 0) lo = 0;
+    if (hi > 7) hi = 7;
+    return (uint8_t)((0xFF << lo) & (0xFF >> (7 - hi)));
+}
+
+// Set or clear the box x0..x1, y0..y1 (inclusive, already ordered)
+static void lcd_fill_area(lcd_nokia5110_priv_t *lcd, int x0, int y0, int x1, int y1, bool on) {
+    int height = lcd->rows * 8;
+    if (x0 >= lcd->width || y0 >= height) return;
+    if (x1 >= lcd->width) x1 = lcd->width - 1;
+    if (y1 >= height) y1 = height - 1;
+
+    for (int row = y0 / 8; row <= y1 / 8; row++) {
+        uint8_t mask = lcd_bank_mask(row, y0, y1);
+        for (int x = x0; x <= x1; x++) {
+            lcd_apply_mask(lcd, row, x, mask, on);
+        }
+    }
+}
+
+void lcd_nokia5110_draw_pixel(lcd_nokia5110_t lcd, uint8_t x, uint8_t y, bool on) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+    if (x >= priv->width || y >= priv->rows * 8) return;
+    lcd_apply_mask(priv, y / 8, x, 1 << (y & 7), on);
+}
+
+void lcd_nokia5110_draw_line(lcd_nokia5110_t lcd, uint8_t x0, uint8_t y0, uint8_t x1, uint8_t y1, bool on) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+
+    // Horizontal and vertical lines are a single byte mask per column/bank
+    if (y0 == y1 || x0 == x1) {
+        lcd_fill_area(priv, x0 < x1 ? x0 : x1, y0 < y1 ? y0 : y1,
+                      x0 < x1 ? x1 : x0, y0 < y1 ? y1 : y0, on);
+        return;
+    }
+
+    // Bresenham
+    int dx = abs(x1 - x0);
+    int dy = -abs(y1 - y0);
+    int sx = x0 < x1 ? 1 : -1;
+    int sy = y0 < y1 ? 1 : -1;
+    int err = dx + dy;
+    int x = x0;
+    int y = y0;
+    while (1) {
+        lcd_nokia5110_draw_pixel(lcd, x, y, on);
+        if (x == x1 && y == y1) break;
+        int e2 = 2 * err;
+        if (e2 >= dy) {
+            err += dy;
+            x += sx;
+        }
+        if (e2 <= dx) {
+            err += dx;
+            y += sy;
+        }
+    }
+}
+
+void lcd_nokia5110_draw_rect(lcd_nokia5110_t lcd, uint8_t x, uint8_t y, uint8_t w, uint8_t h, bool fill, bool on) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+    if (!w || !h) return;
+
+    int x1 = x + w - 1;
+    int y1 = y + h - 1;
+    if (fill) {
+        lcd_fill_area(priv, x, y, x1, y1, on);
+        return;
+    }
+    lcd_fill_area(priv, x, y, x1, y, on); 				// Top
+    lcd_fill_area(priv, x, y1, x1, y1, on); 				// Bottom
+    lcd_fill_area(priv, x, y, x, y1, on); 				// Left
+    lcd_fill_area(priv, x1, y, x1, y1, on); 				// Right
+}
+
+// bitmap is in the framebuffer layout: (h + 7) / 8 banks of w bytes, bit 0
+// on top. It replaces the w x h box; bits of the last bank below h are
+// ignored. Each source byte lands in at most two banks, shifted by y % 8.
+void lcd_nokia5110_draw_bitmap(lcd_nokia5110_t lcd, uint8_t x, uint8_t y, const uint8_t *bitmap, uint8_t w, uint8_t h) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+    if (x >= priv->width || y >= priv->rows * 8) return;
+
+    int cols = x + w > priv->width ? priv->width - x : w;
+    int shift = y & 7;
+
+    for (int src_row = 0; src_row * 8 < h; src_row++) {
+        int rows = h - src_row * 8;
+        uint16_t valid = rows >= 8 ? 0xFF : (0xFF >> (8 - rows));
+        uint16_t mask = valid << shift;
+        int row = y / 8 + src_row;
+        if (row >= priv->rows) break;
+
+        const uint8_t *src = &bitmap[src_row * w];
+        for (int col = 0; col < cols; col++) {
+            uint16_t bits = (uint16_t)((src[col] & valid) << shift);
+            uint8_t *dst = &lcd_back_row(priv, row)[x + col];
+            lcd_put_byte(priv, row, x + col, (*dst & ~mask) | bits);
+            if (shift && row + 1 < priv->rows) {
+                dst = &lcd_back_row(priv, row + 1)[x + col];
+                lcd_put_byte(priv, row + 1, x + col, (*dst & ~(mask >> 8)) | (bits >> 8));
+            }
+        }
+    }
+}
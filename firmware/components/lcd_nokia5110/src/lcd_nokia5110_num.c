@@ -0,0 +1,63 @@
+#include "lcd_nokia5110.h"
+#include "lcd_nokia5110_priv.h"
+
+// Numbers without printf: glyphs are picked from a prerendered digit
+// strip (font_digits.h) and copied straight into the framebuffer.
+
+#define NUM_MAX_CELLS        16
+
+void lcd_nokia5110_write_fixed_font(lcd_nokia5110_t lcd, const font_digits_t *font, int32_t value,
+                                    uint8_t decimals, uint8_t width, uint8_t flags) {
+    lcd_nokia5110_priv_t *priv = (lcd_nokia5110_priv_t *)lcd;
+    uint8_t cells[NUM_MAX_CELLS]; 				// Glyphs, right to left
+    int n = 0;
+
+    if (width > NUM_MAX_CELLS) width = NUM_MAX_CELLS;
+    if (decimals > 9) decimals = 9;
+
+    bool negative = value < 0;
+    uint32_t mag = negative ? -(uint32_t)value : (uint32_t)value;
+
+    // Fraction, point, then at least one integer digit
+    for (uint8_t i = 0; i < decimals; i++) {
+        cells[n++] = mag % 10;
+        mag /= 10;
+    }
+    if (decimals) cells[n++] = FONT_DIGIT_POINT;
+    do {
+        cells[n++] = mag % 10;
+        mag /= 10;
+    } while (mag && n < NUM_MAX_CELLS);
+
+    if ((flags & LCD_NOKIA5110_NUM_ZERO_PAD) && width) {
+        while (n < width - (negative ? 1 : 0)) cells[n++] = 0;
+    }
+    if (negative && n < NUM_MAX_CELLS) cells[n++] = FONT_DIGIT_MINUS;
+
+    // Too wide for the field (or the cell buffer): dashes instead of a
+    // truncated, misleading value
+    if (mag || (width && n > width)) {
+        n = width ? width : 1;
+        for (int i = 0; i < n; i++) cells[i] = FONT_DIGIT_MINUS;
+    }
+    while (n < width) cells[n++] = FONT_DIGIT_SPACE;
+
+    // Cells are bank-aligned: each bank of a glyph is one column run
+    uint16_t cell_size = font->width * font->banks;
+    while (n--) {
+        const uint8_t *cell = &font->cells[cells[n] * cell_size];
+        for (uint8_t bank = 0; bank < font->banks; bank++) {
+            uint8_t row = priv->y_pos + bank;
+            if (row >= priv->rows) break;
+            for (uint8_t col = 0; col < font->width && priv->x_pos + col < priv->width; col++) {
+                lcd_put_byte(priv, row, priv->x_pos + col, cell[bank * font->width + col]);
+            }
+        }
+        uint16_t next = priv->x_pos + font->width;
+        priv->x_pos = next < priv->width ? next : priv->width;
+    }
+}
+
+void lcd_nokia5110_write_fixed(lcd_nokia5110_t lcd, int32_t value, uint8_t decimals, uint8_t width, uint8_t flags) {
+    lcd_nokia5110_write_fixed_font(lcd, &font_digits_1x, value, decimals, width, flags);
+}
@@ -0,0 +1,199 @@
+#include "lcd_nokia5110_priv.h"
+#include "esp_log.h"
+
+static const char *TAG = "PCD8544";
+
+#define PCD8544_WIDTH        84
+#define PCD8544_ROWS         6
+#define PCD8544_CLOCK_HZ     (4 * 1000 * 1000)
+
+// Clean bytes between two dirty spans that are cheaper to resend than
+// opening a new burst (2 address bytes plus two transaction setups)
+#define LCD_MERGE_GAP        16
+
+#define LCD_QUEUE_DEPTH      HAL_SPI_MAX_QUEUE 			// Transfers in flight per flush
+
+// PCD8544 driver commands
+#define CMD_FUNCTION_SET     0x20
+#define CMD_POWER_DOWN       0x04 				// Function set PD bit
+#define CMD_DISPLAY_CONTROL  0x08
+#define CMD_SET_Y_ADDR       0x40
+#define CMD_SET_X_ADDR       0x80
+#define CMD_TEMP_CONTROL     0x04
+#define CMD_BIAS_SYSTEM      0x10
+#define CMD_SET_VOP          0x80
+
+// Queue a run of bytes as one SPI transfer. The HAL sets DC from the
+// transfer's pre-callback, so a run is either all commands or all data
+// and segments of different kinds still go back to back.
+static esp_err_t lcd_queue(lcd_nokia5110_priv_t *lcd, const uint8_t *buf, size_t len, bool is_data) {
+    lcd_count_transfer(lcd, len);
+    return hal_spi_queue(lcd->spi_dev, buf, len, is_data ? 1 : 0);
+}
+
+static esp_err_t pcd8544_init(lcd_nokia5110_priv_t *lcd, const lcd_nokia5110_config_t *config) {
+    esp_err_t ret;
+
+    lcd->width = PCD8544_WIDTH;
+    lcd->rows = PCD8544_ROWS;
+
+    // GPIO pins configuration
+    lcd->pin_dc = config->pin_dc;
+    lcd->pin_reset = config->pin_rst;
+    lcd->pin_cs = config->pin_cs;
+    lcd->spi_host = config->spi_host;
+
+    // Pins configuration
+    hal_dio_config((1ULL << lcd->pin_dc) | (1ULL << lcd->pin_reset), HAL_PIN_OUTPUT, HAL_EDGE_NONE);
+
+    // Reset hardware
+    hal_dio_write(lcd->pin_reset, 0);
+    hal_delay_ms(10);
+    hal_dio_write(lcd->pin_reset, 1);
+    hal_delay_ms(100);
+
+    // SPI configuration. The HAL bus uses DMA, so a full frame fits in a
+    // single transaction.
+    hal_spi_bus_config_t buscfg = {
+        .host = config->spi_host,
+        .pin_mosi = config->pin_din,
+        .pin_miso = -1,
+        .pin_sclk = config->pin_sclk,
+    };
+
+    hal_spi_dev_config_t devcfg = {
+        .name = "lcd",
+        .host = config->spi_host,
+        .pin_cs = lcd->pin_cs,
+        .pin_dc = lcd->pin_dc,
+        .clock_hz = config->clock_hz ? config->clock_hz : PCD8544_CLOCK_HZ,
+        .mode = 0, 							// SPI mode 0
+        .queue_size = LCD_QUEUE_DEPTH,
+    };
+
+    // Initialize SPI bus and device
+    ret = hal_spi_bus_init(&buscfg);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI init failed: %s", esp_err_to_name(ret));
+        return ret;
+    }
+
+    ret = hal_spi_add_device(&devcfg, &lcd->spi_dev);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "SPI add device failed: %s", esp_err_to_name(ret));
+        hal_spi_bus_free(lcd->spi_host);
+        return ret;
+    }
+
+    if (config->bus_priority) {
+        hal_spi_client_config_t clientcfg = {
+            .host = config->spi_host,
+            .name = "lcd",
+            .priority = config->bus_priority,
+        };
+        ret = hal_spi_add_client(&clientcfg, &lcd->bus_client);
+        if (ret != ESP_OK) {
+            ESP_LOGE(TAG, "SPI bus client failed: %s", esp_err_to_name(ret));
+            hal_spi_remove_device(lcd->spi_dev);
+            hal_spi_bus_free(lcd->spi_host);
+            return ret;
+        }
+    }
+
+    // Initialize screen
+    const uint8_t init_cmds[] = {
+        CMD_FUNCTION_SET | 0x01, 					// Extended instructions
+        CMD_SET_VOP | lcd->contrast, 					// Contrast
+        CMD_TEMP_CONTROL | 0x02, 					// Temp coefficient
+        CMD_BIAS_SYSTEM | 0x03, 					// Bias mode
+        CMD_FUNCTION_SET, 						// Basic instructions, horizontal addressing
+        CMD_DISPLAY_CONTROL | 0x04, 					// Normal mode
+    };
+    lcd_stage_commands(lcd, init_cmds, sizeof(init_cmds));
+    return ESP_OK;
+}
+
+// Queue front buffer bytes [start, end), counted bank-major, as one
+// addressed burst. The PCD8544 auto-increments X and wraps into the next
+// bank in horizontal addressing mode, so a burst may span banks.
+static void pcd8544_queue_burst(lcd_nokia5110_priv_t *lcd, uint16_t start, uint16_t end) {
+    const uint8_t addr[] = {
+        CMD_SET_Y_ADDR | (start / PCD8544_WIDTH),
+        CMD_SET_X_ADDR | (start % PCD8544_WIDTH),
+    };
+    lcd_queue(lcd, addr, sizeof(addr), false);
+    lcd_queue(lcd, &lcd->front[start], end - start, true);
+}
+
+// Queue one burst per bank, merging spans whose gap is at most
+// LCD_MERGE_GAP bytes. A fully dirty frame becomes a single burst.
+static void pcd8544_send(lcd_nokia5110_priv_t *lcd, const uint8_t *cmds, size_t cmd_len, const lcd_span_t *spans) {
+    int burst_start = -1;
+    int burst_end = 0;
+
+    // On a shared host the whole flush is one hold, so a frame is not
+    // interleaved with the other devices
+    if (lcd->bus_client) hal_spi_acquire(lcd->bus_client);
+    if (cmd_len) lcd_queue(lcd, cmds, cmd_len, false);
+
+    for (uint8_t row = 0; row < PCD8544_ROWS; row++) {
+        if (spans[row].x0 >= spans[row].x1) continue;
+
+        int span_start = row * PCD8544_WIDTH + spans[row].x0;
+        int span_end = row * PCD8544_WIDTH + spans[row].x1;
+        if (burst_start >= 0 && span_start - burst_end <= LCD_MERGE_GAP) {
+            burst_end = span_end;
+            continue;
+        }
+        if (burst_start >= 0) pcd8544_queue_burst(lcd, burst_start, burst_end);
+        burst_start = span_start;
+        burst_end = span_end;
+    }
+    if (burst_start >= 0) pcd8544_queue_burst(lcd, burst_start, burst_end);
+
+    hal_spi_wait(lcd->spi_dev);
+    if (lcd->bus_client) hal_spi_release(lcd->bus_client);
+}
+
+static void pcd8544_set_contrast(lcd_nokia5110_priv_t *lcd, uint8_t contrast) {
+    uint8_t pd = lcd->asleep ? CMD_POWER_DOWN : 0;
+    const uint8_t cmds[] = {
+        CMD_FUNCTION_SET | pd | 0x01, 				// Ext. instr.
+        CMD_SET_VOP | contrast,
+        CMD_FUNCTION_SET | pd, 					// Basic instr.
+    };
+    lcd_stage_commands(lcd, cmds, sizeof(cmds));
+}
+
+static void pcd8544_invert(lcd_nokia5110_priv_t *lcd, bool invert) {
+    const uint8_t cmd = CMD_DISPLAY_CONTROL | (invert ? 0x05 : 0x04);
+    lcd_stage_commands(lcd, &cmd, 1);
+}
+
+// PD bit of the function set. The controller keeps its RAM.
+static void pcd8544_sleep(lcd_nokia5110_priv_t *lcd, bool sleep) {
+    const uint8_t cmd = CMD_FUNCTION_SET | (sleep ? CMD_POWER_DOWN : 0);
+    lcd_stage_commands(lcd, &cmd, 1);
+}
+
+static void pcd8544_deinit(lcd_nokia5110_priv_t *lcd) {
+    // 1. Remove the SPI device and its bus client
+    if (lcd->spi_dev) {
+        hal_spi_remove_device(lcd->spi_dev);
+    }
+    if (lcd->bus_client) {
+        hal_spi_remove_client(lcd->bus_client);
+    }
+
+    // 2. Release the SPI bus (using the host)
+    hal_spi_bus_free(lcd->spi_host);
+}
+
+const lcd_panel_ops_t lcd_panel_pcd8544 = {
+    .init = pcd8544_init,
+    .send = pcd8544_send,
+    .set_contrast = pcd8544_set_contrast,
+    .invert = pcd8544_invert,
+    .sleep = pcd8544_sleep,
+    .deinit = pcd8544_deinit,
+};
@@ -0,0 +1,215 @@
+#include "lcd_nokia5110_priv.h"
+#include <stdlib.h>
+#include <string.h>
+#include "esp_log.h"
+
+static const char *TAG = "SSD1306";
+
+#define SSD1306_WIDTH        128
+#define SSD1306_HEIGHT       64
+#define SSD1306_ADDR         0x3C
+#define SSD1306_CLOCK_HZ     (400 * 1000)
+
+// Control byte in front of every transaction: the rest is a command
+// stream or a data stream (Co = 0)
+#define SSD1306_CTRL_CMD     0x00
+#define SSD1306_CTRL_DATA    0x40
+
+// Bus bytes a window costs on top of its data: 6 address command bytes,
+// one more control byte and the start, address and stop of the data
+// transaction. Cheaper to resend clean bytes than to open a window for
+// less.
+#define SSD1306_WINDOW_COST  10
+
+// SSD1306 commands
+#define CMD_SET_CONTRAST     0x81
+#define CMD_ENTIRE_ON        0xA4 				// | 1: all pixels on
+#define CMD_INVERSE          0xA6 				// | 1: inverse video
+#define CMD_DISPLAY_OFF      0xAE
+#define CMD_DISPLAY_ON       0xAF
+#define CMD_MEMORY_MODE      0x20
+#define CMD_COLUMN_ADDR      0x21
+#define CMD_PAGE_ADDR        0x22
+#define CMD_START_LINE       0x40
+#define CMD_SEG_REMAP        0xA1 				// Column 127 is SEG0
+#define CMD_MUX_RATIO        0xA8
+#define CMD_COM_SCAN_DEC     0xC8
+#define CMD_DISPLAY_OFFSET   0xD3
+#define CMD_CLOCK_DIV        0xD5
+#define CMD_PRECHARGE        0xD9
+#define CMD_COM_PINS         0xDA
+#define CMD_VCOMH_DESELECT   0xDB
+#define CMD_CHARGE_PUMP      0x8D
+
+// One transaction: control byte, then commands or a whole window of data
+typedef struct {
+    uint8_t buf[1 + LCD_BUFFER_SIZE];
+    size_t len;
+} ssd1306_tx_t;
+
+static void ssd1306_write(lcd_nokia5110_priv_t *lcd, const uint8_t *buf, size_t len) {
+    lcd_count_transfer(lcd, len);
+    hal_i2c_write(lcd->i2c_dev, buf, len);
+}
+
+static esp_err_t ssd1306_init(lcd_nokia5110_priv_t *lcd, const lcd_nokia5110_config_t *config) {
+    esp_err_t ret;
+
+    uint8_t height = config->height ? config->height : SSD1306_HEIGHT;
+    if (height != 32 && height != 64) return ESP_ERR_INVALID_ARG;
+
+    lcd->width = SSD1306_WIDTH;
+    lcd->rows = height / 8;
+    lcd->i2c_port = config->i2c_port;
+
+    lcd->i2c_tx = malloc(sizeof(ssd1306_tx_t));
+    if (!lcd->i2c_tx) return ESP_ERR_NO_MEM;
+
+    hal_i2c_bus_config_t buscfg = {
+        .port = config->i2c_port,
+        .pin_sda = config->pin_sda,
+        .pin_scl = config->pin_scl,
+    };
+    hal_i2c_dev_config_t devcfg = {
+        .port = config->i2c_port,
+        .addr = config->i2c_addr ? config->i2c_addr : SSD1306_ADDR,
+        .clock_hz = config->clock_hz ? config->clock_hz : SSD1306_CLOCK_HZ,
+    };
+
+    ret = hal_i2c_bus_init(&buscfg);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "I2C init failed: %s", esp_err_to_name(ret));
+        free(lcd->i2c_tx);
+        return ret;
+    }
+
+    ret = hal_i2c_add_device(&devcfg, &lcd->i2c_dev);
+    if (ret != ESP_OK) {
+        ESP_LOGE(TAG, "I2C add device failed: %s", esp_err_to_name(ret));
+        hal_i2c_bus_free(lcd->i2c_port);
+        free(lcd->i2c_tx);
+        return ret;
+    }
+
+    // Most I2C modules reset themselves at power up, RST is not wired
+    const uint8_t init_cmds[] = {
+        CMD_DISPLAY_OFF,
+        CMD_CLOCK_DIV, 0x80, 					// Default oscillator
+        CMD_MUX_RATIO, height - 1,
+        CMD_DISPLAY_OFFSET, 0x00,
+        CMD_START_LINE | 0,
+        CMD_CHARGE_PUMP, 0x14, 					// Internal charge pump
+        CMD_MEMORY_MODE, 0x00, 					// Horizontal addressing
+        CMD_SEG_REMAP,
+        CMD_COM_SCAN_DEC, 					// With the remap: upright, bank 0 on top
+        CMD_COM_PINS, height == 64 ? 0x12 : 0x02,
+        CMD_SET_CONTRAST, lcd->contrast << 1,
+        CMD_PRECHARGE, 0xF1,
+        CMD_VCOMH_DESELECT, 0x40,
+        CMD_ENTIRE_ON,
+        CMD_INVERSE,
+        CMD_DISPLAY_ON,
+    };
+    lcd_stage_commands(lcd, init_cmds, sizeof(init_cmds));
+    return ESP_OK;
+}
+
+// Send pages p0..p1, columns [x0, x1) as one data transaction. Staged
+// commands ride in the same command transaction as the window address.
+static void ssd1306_send_window(lcd_nokia5110_priv_t *lcd, ssd1306_tx_t *tx, uint8_t x0, uint8_t x1,
+                                uint8_t p0, uint8_t p1) {
+    const uint8_t addr[] = {
+        CMD_COLUMN_ADDR, x0, x1 - 1,
+        CMD_PAGE_ADDR, p0, p1,
+    };
+    memcpy(&tx->buf[tx->len], addr, sizeof(addr));
+    ssd1306_write(lcd, tx->buf, tx->len + sizeof(addr));
+
+    // The window wraps column by column into the next page, so the data
+    // is the window's rows back to back
+    size_t len = 1;
+    tx->buf[0] = SSD1306_CTRL_DATA;
+    for (uint8_t page = p0; page <= p1; page++) {
+        memcpy(&tx->buf[len], &lcd_front_row(lcd, page)[x0], x1 - x0);
+        len += x1 - x0;
+    }
+    ssd1306_write(lcd, tx->buf, len);
+
+    tx->buf[0] = SSD1306_CTRL_CMD;
+    tx->len = 1;
+}
+
+// Dirty pages become address windows. A page joins the open window when
+// widening it costs fewer bytes than a window of its own, so a fully
+// dirty frame is a single 1 KB transaction.
+static void ssd1306_send(lcd_nokia5110_priv_t *lcd, const uint8_t *cmds, size_t cmd_len, const lcd_span_t *spans) {
+    ssd1306_tx_t *tx = lcd->i2c_tx;
+    tx->buf[0] = SSD1306_CTRL_CMD;
+    memcpy(&tx->buf[1], cmds, cmd_len);
+    tx->len = 1 + cmd_len;
+
+    bool open = false;
+    uint8_t x0 = 0, x1 = 0, p0 = 0, p1 = 0;
+    for (uint8_t page = 0; page < lcd->rows; page++) {
+        lcd_span_t span = spans[page];
+        if (span.x0 >= span.x1) continue;
+
+        if (open) {
+            uint8_t mx0 = span.x0 < x0 ? span.x0 : x0;
+            uint8_t mx1 = span.x1 > x1 ? span.x1 : x1;
+            unsigned merged = (unsigned)(mx1 - mx0) * (page - p0 + 1);
+            unsigned split = (unsigned)(x1 - x0) * (p1 - p0 + 1) + (span.x1 - span.x0) + SSD1306_WINDOW_COST;
+            if (merged <= split) {
+                x0 = mx0;
+                x1 = mx1;
+                p1 = page;
+                continue;
+            }
+            ssd1306_send_window(lcd, tx, x0, x1, p0, p1);
+        }
+        open = true;
+        x0 = span.x0;
+        x1 = span.x1;
+        p0 = page;
+        p1 = page;
+    }
+    if (open) {
+        ssd1306_send_window(lcd, tx, x0, x1, p0, p1);
+    } else if (cmd_len) {
+        ssd1306_write(lcd, tx->buf, tx->len);
+    }
+}
+
+static void ssd1306_set_contrast(lcd_nokia5110_priv_t *lcd, uint8_t contrast) {
+    const uint8_t cmds[] = { CMD_SET_CONTRAST, contrast << 1 };
+    lcd_stage_commands(lcd, cmds, sizeof(cmds));
+}
+
+static void ssd1306_invert(lcd_nokia5110_priv_t *lcd, bool invert) {
+    const uint8_t cmd = CMD_INVERSE | (invert ? 1 : 0);
+    lcd_stage_commands(lcd, &cmd, 1);
+}
+
+// About 10 uA with the charge pump off; GDDRAM is kept
+static void ssd1306_sleep(lcd_nokia5110_priv_t *lcd, bool sleep) {
+    const uint8_t off[] = { CMD_DISPLAY_OFF, CMD_CHARGE_PUMP, 0x10 };
+    const uint8_t on[] = { CMD_CHARGE_PUMP, 0x14, CMD_DISPLAY_ON };
+    lcd_stage_commands(lcd, sleep ? off : on, sleep ? sizeof(off) : sizeof(on));
+}
+
+static void ssd1306_deinit(lcd_nokia5110_priv_t *lcd) {
+    if (lcd->i2c_dev) {
+        hal_i2c_remove_device(lcd->i2c_dev);
+    }
+    hal_i2c_bus_free(lcd->i2c_port);
+    free(lcd->i2c_tx);
+}
+
+const lcd_panel_ops_t lcd_panel_ssd1306 = {
+    .init = ssd1306_init,
+    .send = ssd1306_send,
+    .set_contrast = ssd1306_set_contrast,
+    .invert = ssd1306_invert,
+    .sleep = ssd1306_sleep,
+    .deinit = ssd1306_deinit,
+};
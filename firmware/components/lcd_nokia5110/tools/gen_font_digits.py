@@ -0,0 +1,122 @@
+#!/usr/bin/env python3
+"""Generate the digit strips used by lcd_nokia5110_write_fixed().
+
+Reads the digits, '.', '-' and space of the 5x7 font from font_5x7.c and
+writes them, 1x, 2x and 3x scaled, plus a 7-segment style set, as const
+bank-aligned cells (the framebuffer layout: one byte per 8-pixel column,
+bit 0 on top), so drawing a large number is a column copy with no
+scaling at run time. Run by the component's CMakeLists.txt at build time.
+
+Usage:
+    python3 tools/gen_font_digits.py src/font_5x7.c -o font_digits.c
+"""
+
+import argparse
+import re
+import sys
+
+GLYPHS = "0123456789.- "                    # Order of FONT_DIGIT_* in font_digits.h
+ROW_RE = re.compile(r"\{\s*(0x[0-9A-Fa-f]{2}(?:\s*,\s*0x[0-9A-Fa-f]{2}){4})\s*\},\s*//\s*(\d+):")
+
+# 7-segment cell: 10 x 15 px digit, 2 px strokes, in a 12 x 16 cell
+SEG_W, SEG_H = 10, 15
+# Segment boxes (x0, y0, x1, y1), inclusive, with a gap at each joint
+SEGMENTS = {
+    "a": (2, 0, 7, 1), "b": (8, 2, 9, 6), "c": (8, 9, 9, 12), "d": (2, 13, 7, 14),
+    "e": (0, 9, 1, 12), "f": (0, 2, 1, 6), "g": (2, 7, 7, 8),
+}
+SEG_DIGITS = {
+    "0": "abcdef", "1": "bc", "2": "abdeg", "3": "abcdg", "4": "bcfg",
+    "5": "acdfg", "6": "acdefg", "7": "abc", "8": "abcdefg", "9": "abcdfg",
+    "-": "g", " ": "",
+}
+
+
+def load_font(path):
+    """5 column bytes per character code, from the font_5x7 table rows."""
+    font = {}
+    with open(path, encoding="utf-8") as f:
+        for m in ROW_RE.finditer(f.read()):
+            font[chr(int(m.group(2)))] = [int(b, 16) for b in m.group(1).split(",")]
+    missing = [c for c in GLYPHS if c not in font]
+    if missing:
+        sys.exit(f"{path}: no glyph for {missing!r}")
+    return font
+
+
+def pixels_5x7(columns):
+    """Pixel set {(x, y)} of a 5x7 glyph plus its spacer column."""
+    return {(x, y) for x, col in enumerate(columns) for y in range(8) if col >> y & 1}
+
+
+def scale(pixels, n):
+    return {(x * n + i, y * n + j) for x, y in pixels for i in range(n) for j in range(n)}
+
+
+def segments(glyph):
+    if glyph == ".":
+        return {(x, y) for x in (4, 5) for y in (13, 14)}
+    pixels = set()
+    for seg in SEG_DIGITS[glyph]:
+        x0, y0, x1, y1 = SEGMENTS[seg]
+        pixels |= {(x, y) for x in range(x0, x1 + 1) for y in range(y0, y1 + 1)}
+    return pixels
+
+
+def cells(pixels, width, banks):
+    """Bank-major column bytes of one cell."""
+    out = []
+    for bank in range(banks):
+        for x in range(width):
+            byte = 0
+            for bit in range(8):
+                if (x, bank * 8 + bit) in pixels:
+                    byte |= 1 << bit
+            out.append(byte)
+    return out
+
+
+def emit(name, width, banks, glyph_pixels, comment):
+    lines = [f"// {comment}: {width} x {banks * 8} px cells",
+             f"static const uint8_t {name}_cells[FONT_DIGIT_GLYPHS * {width * banks}] = {{"]
+    for glyph, pixels in zip(GLYPHS, glyph_pixels):
+        data = cells(pixels, width, banks)
+        label = "space" if glyph == " " else glyph
+        for bank in range(banks):
+            row = ", ".join(f"0x{b:02X}" for b in data[bank * width:(bank + 1) * width])
+            tail = f" \t\t// {label}" if bank == 0 else ""
+            lines.append(f"    {row},{tail}")
+    lines.append("};")
+    lines.append(f"const font_digits_t {name} = {{ {width}, {banks}, {name}_cells }};")
+    return "\n".join(lines)
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("font", help="font_5x7.c")
+    parser.add_argument("-o", "--output", required=True)
+    args = parser.parse_args()
+
+    font = load_font(args.font)
+    base = [pixels_5x7(font[g]) for g in GLYPHS]
+
+    parts = [
+        "// Generated by tools/gen_font_digits.py from font_5x7.c, do not edit",
+        "",
+        '#include "font_digits.h"',
+        "",
+        emit("font_digits_1x", 6, 1, base, "5x7"),
+        "",
+        emit("font_digits_2x", 12, 2, [scale(p, 2) for p in base], "5x7 scaled 2x"),
+        "",
+        emit("font_digits_3x", 18, 3, [scale(p, 3) for p in base], "5x7 scaled 3x"),
+        "",
+        emit("font_digits_7seg", SEG_W + 2, 2, [segments(g) for g in GLYPHS], "7-segment"),
+        "",
+    ]
+    with open(args.output, "w", encoding="utf-8") as f:
+        f.write("\n".join(parts))
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,55 @@
+#ifndef RIDER_PROFILE_H
+#define RIDER_PROFILE_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "motor_control.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Rider profiles stored on the tag.
+// A 16-byte record in four NTAG21x pages, from CONFIG_PROFILE_NTAG_PAGE,
+// read with one FAST_READ while the tag is being activated:
+//   0  'E' 'B'        magic
+//   2  version        RIDER_PROFILE_VERSION
+//   3  flags          bit 0: accelerator enabled
+//   4  assist min %   at the potentiometer's low end
+//   5  assist max %   at its high end, 100 at most
+//   6  speed limit    km/h, 0: none
+//   7  0
+//   8  kp, ki, kd     little-endian uint16, thousandths
+//  14  CRC_A          of bytes 0-13, little-endian (ISO 14443-3)
+// Results are cached by UID, so the tag is read once per power cycle.
+// Tags without a valid record, or without FAST_READ, ride the defaults.
+
+#define RIDER_PROFILE_SIZE      16
+#define RIDER_PROFILE_VERSION   1
+
+typedef enum {
+    RIDER_PROFILE_NONE = 0, 				// No valid record: defaults
+    RIDER_PROFILE_READ, 				// Read from the tag
+    RIDER_PROFILE_CACHED, 				// From an earlier tap, no read
+} rider_profile_source_t;
+
+// Profile of the tag in the rfid callback: from the cache, else read from
+// the tag and cached. Never NULL; source may be NULL.
+const motor_profile_t *rider_profile_load(const uint8_t *uid, size_t uid_len, rider_profile_source_t *source);
+
+// ESP_ERR_INVALID_CRC, ESP_ERR_INVALID_VERSION or ESP_ERR_INVALID_ARG
+// (bad magic or limits) for a record that cannot be used
+esp_err_t rider_profile_decode(const uint8_t record[RIDER_PROFILE_SIZE], motor_profile_t *profile);
+
+// Gains are rounded to thousandths, up to 65.535
+esp_err_t rider_profile_encode(const motor_profile_t *profile, uint8_t record[RIDER_PROFILE_SIZE]);
+
+// Forget every cached profile
+void rider_profile_clear_cache(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// RIDER_PROFILE_H
@@ -0,0 +1,118 @@
+#include "rider_profile.h"
+#include <string.h>
+#include <math.h>
+#include "sdkconfig.h"
+#include "rfid.h"
+#include "rc522_crc.h"
+
+#define PROFILE_MAGIC_0      'E'
+#define PROFILE_MAGIC_1      'B'
+#define PROFILE_FLAG_THROTTLE 0x01
+#define PROFILE_LAST_PAGE    (CONFIG_PROFILE_NTAG_PAGE + RIDER_PROFILE_SIZE / 4 - 1)
+#define GAIN_SCALE           1000.0
+
+typedef struct {
+    uint8_t uid_len; 					// 0: free
+    uint8_t uid[RFID_UID_MAX_LEN];
+    bool valid; 					// false: the tag has no profile
+    motor_profile_t profile;
+} profile_entry_t;
+
+// Only touched from the rfid callback, in the scanner task
+static profile_entry_t cache[CONFIG_PROFILE_CACHE_SIZE];
+static uint8_t cache_next; 				// Round-robin replacement
+
+static uint16_t get_u16(const uint8_t *p) {
+    return p[0] | (p[1] << 8);
+}
+
+static void put_u16(uint8_t *p, uint16_t v) {
+    p[0] = v & 0xFF;
+    p[1] = v >> 8;
+}
+
+esp_err_t rider_profile_decode(const uint8_t record[RIDER_PROFILE_SIZE], motor_profile_t *profile) {
+    // The CRC over the data and the stored CRC is zero
+    if (rc522_crc_a(record, RIDER_PROFILE_SIZE) != 0) return ESP_ERR_INVALID_CRC;
+    if (record[0] != PROFILE_MAGIC_0 || record[1] != PROFILE_MAGIC_1) return ESP_ERR_INVALID_ARG;
+    if (record[2] != RIDER_PROFILE_VERSION) return ESP_ERR_INVALID_VERSION;
+    if (record[4] > record[5] || record[5] > 100) return ESP_ERR_INVALID_ARG;
+
+    profile->throttle = record[3] & PROFILE_FLAG_THROTTLE;
+    profile->assist_min = record[4];
+    profile->assist_max = record[5];
+    profile->speed_limit_kmh = record[6];
+    profile->kp = get_u16(&record[8]) / GAIN_SCALE;
+    profile->ki = get_u16(&record[10]) / GAIN_SCALE;
+    profile->kd = get_u16(&record[12]) / GAIN_SCALE;
+    return ESP_OK;
+}
+
+static bool gain_fits(double gain) {
+    return gain >= 0 && gain * GAIN_SCALE <= UINT16_MAX + 0.5;
+}
+
+esp_err_t rider_profile_encode(const motor_profile_t *profile, uint8_t record[RIDER_PROFILE_SIZE]) {
+    if (profile->assist_min > profile->assist_max || profile->assist_max > 100) return ESP_ERR_INVALID_ARG;
+    if (!gain_fits(profile->kp) || !gain_fits(profile->ki) || !gain_fits(profile->kd)) return ESP_ERR_INVALID_ARG;
+
+    memset(record, 0, RIDER_PROFILE_SIZE);
+    record[0] = PROFILE_MAGIC_0;
+    record[1] = PROFILE_MAGIC_1;
+    record[2] = RIDER_PROFILE_VERSION;
+    record[3] = profile->throttle ? PROFILE_FLAG_THROTTLE : 0;
+    record[4] = profile->assist_min;
+    record[5] = profile->assist_max;
+    record[6] = profile->speed_limit_kmh;
+    put_u16(&record[8], (uint16_t)lround(profile->kp * GAIN_SCALE));
+    put_u16(&record[10], (uint16_t)lround(profile->ki * GAIN_SCALE));
+    put_u16(&record[12], (uint16_t)lround(profile->kd * GAIN_SCALE));
+    put_u16(&record[14], rc522_crc_a(record, RIDER_PROFILE_SIZE - 2));
+    return ESP_OK;
+}
+
+static profile_entry_t *cache_find(const uint8_t *uid, size_t uid_len) {
+    for (int i = 0; i < CONFIG_PROFILE_CACHE_SIZE; i++) {
+        if (cache[i].uid_len == uid_len && memcmp(cache[i].uid, uid, uid_len) == 0) return &cache[i];
+    }
+    return NULL;
+}
+
+// Cache entry for a tag not seen before, NULL if it could not be read
+static profile_entry_t *cache_fill(const uint8_t *uid, size_t uid_len) {
+    uint8_t record[RIDER_PROFILE_SIZE];
+    esp_err_t ret = rfid_read_pages(CONFIG_PROFILE_NTAG_PAGE, PROFILE_LAST_PAGE, record, sizeof(record));
+
+    // A failed transfer (tag pulled away) is tried again at the next tap;
+    // a tag without FAST_READ or without a valid record is remembered
+    if (ret != ESP_OK && ret != ESP_ERR_NOT_SUPPORTED) return NULL;
+
+    profile_entry_t *entry = &cache[cache_next];
+    cache_next = (cache_next + 1) % CONFIG_PROFILE_CACHE_SIZE;
+    entry->uid_len = uid_len;
+    memcpy(entry->uid, uid, uid_len);
+    entry->valid = ret == ESP_OK && rider_profile_decode(record, &entry->profile) == ESP_OK;
+    return entry;
+}
+
+const motor_profile_t *rider_profile_load(const uint8_t *uid, size_t uid_len, rider_profile_source_t *source) {
+    rider_profile_source_t from = RIDER_PROFILE_CACHED;
+    profile_entry_t *entry = NULL;
+
+    if (uid && uid_len > 0 && uid_len <= RFID_UID_MAX_LEN) {
+        entry = cache_find(uid, uid_len);
+        if (!entry) {
+            entry = cache_fill(uid, uid_len);
+            from = RIDER_PROFILE_READ;
+        }
+    }
+    if (!entry || !entry->valid) from = RIDER_PROFILE_NONE;
+
+    if (source) *source = from;
+    return from == RIDER_PROFILE_NONE ? &motor_profile_default : &entry->profile;
+}
+
+void rider_profile_clear_cache(void) {
+    memset(cache, 0, sizeof(cache));
+    cache_next = 0;
+}
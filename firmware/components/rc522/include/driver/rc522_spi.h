@@ -11,6 +11,11 @@ extern "C" {
 #define RC522_SPI_WRITE (0)
 #define RC522_SPI_READ  (1)
 
+/**
+ * The device runs full-duplex, with no command or address phase: every
+ * transaction carries the MFRC522 address byte as its first byte, and
+ * that byte in its user field, for pre_cb and post_cb.
+ */
 typedef struct
 {
     spi_host_device_t host_id;
@@ -23,6 +28,17 @@ typedef struct
      * Set to -1 if the RST pin is not connected.
      */
     gpio_num_t rst_io_num;
+
+    /**
+     * Optional arbitration of a host shared with other devices.
+     * bus_acquire is called before and bus_release after every
+     * register access, or once around a whole PICC command with
+     * CONFIG_RC522_SPI_BURST, with bus_ctx. Leave NULL if the host
+     * is not shared.
+     */
+    esp_err_t (*bus_acquire)(void *ctx);
+    void (*bus_release)(void *ctx);
+    void *bus_ctx;
 } rc522_spi_config_t;
 
 esp_err_t rc522_spi_create(const rc522_spi_config_t *config, rc522_driver_handle_t *driver);
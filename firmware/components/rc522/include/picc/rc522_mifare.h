@@ -23,6 +23,7 @@ extern "C" {
 typedef struct
 {
     uint8_t number_of_sectors;
+    uint16_t number_of_blocks; // Total number of blocks, including the sector trailers
 } rc522_mifare_desc_t;
 
 typedef struct
@@ -132,6 +133,26 @@ esp_err_t rc522_mifare_read(const rc522_handle_t rc522, const rc522_picc_t *picc
 esp_err_t rc522_mifare_write(const rc522_handle_t rc522, const rc522_picc_t *picc, uint8_t block_address,
     const uint8_t buffer[RC522_MIFARE_BLOCK_SIZE]);
 
+/**
+ * @brief Read consecutive blocks into one buffer, authenticating once per sector.
+ *
+ * Authenticates with @c key at the first block and at each sector boundary, then reads
+ * the blocks of that sector back to back. The bus is held from the first authentication
+ * to the last block, except while the PICC answers. Sector trailers in the range are
+ * returned as the PICC reads them (Key A reads as zeros).
+ *
+ * @note The last sector stays authenticated; call @c rc522_mifare_deauth() when done.
+ *
+ * @param rc522 RC522 handle
+ * @param picc PICC that is currently selected
+ * @param key Key for every sector in the range
+ * @param first_block Address of the first block to read
+ * @param block_count Number of blocks; @c number_of_blocks from @c rc522_mifare_get_desc() for the whole card
+ * @param[out] out_buffer Buffer of at least @c block_count * @c RC522_MIFARE_BLOCK_SIZE bytes
+ */
+esp_err_t rc522_mifare_read_blocks(const rc522_handle_t rc522, const rc522_picc_t *picc,
+    const rc522_mifare_key_t *key, uint8_t first_block, uint16_t block_count, uint8_t *out_buffer);
+
 // }}
 
 // {{ MIFARE_Utility_Functions
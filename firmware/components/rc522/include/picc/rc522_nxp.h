@@ -233,6 +233,11 @@ uint8_t rc522_nxp_get_user_mem_start(rc522_picc_type_t type);
  */
 uint8_t rc522_nxp_get_user_mem_end(rc522_picc_type_t type);
 
+/**
+ * @brief Checks if the PICC supports FAST_READ (UL EV1, UL AES, NTAG21x)
+ */
+bool rc522_nxp_type_has_fast_read(rc522_picc_type_t type);
+
 /**
  * @brief Determine the type of an NXP PICC
  *
@@ -0,0 +1,43 @@
+#pragma once
+
+#include "rc522_types.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+ESP_EVENT_DECLARE_BASE(RC522_EVENTS);
+
+esp_err_t rc522_create(const rc522_config_t *config, rc522_handle_t *out_rc522);
+
+esp_err_t rc522_register_events(
+    const rc522_handle_t rc522, rc522_event_t event, esp_event_handler_t event_handler, void *event_handler_arg);
+
+esp_err_t rc522_unregister_events(const rc522_handle_t rc522, rc522_event_t event, esp_event_handler_t event_handler);
+
+typedef void (*rc522_picc_state_callback_t)(const rc522_picc_t *picc, rc522_picc_state_t old_state, void *ctx);
+
+/**
+ * Call @p callback on every PICC state change, in the rc522 task right
+ * after the change and before the RC522_EVENT_PICC_STATE_CHANGED
+ * handlers. Unlike the event it is not copied into an event loop first.
+ * The PICC functions can be used from it. One callback per scanner:
+ * setting another replaces it, NULL removes it.
+ */
+esp_err_t rc522_set_picc_state_callback(rc522_handle_t rc522, rc522_picc_state_callback_t callback, void *ctx);
+
+esp_err_t rc522_start(rc522_handle_t rc522);
+
+esp_err_t rc522_pause(rc522_handle_t rc522);
+
+/**
+ * Presence checks and antenna on time since rc522_start(). Take the
+ * difference of two snapshots for rates and the RF duty cycle.
+ */
+esp_err_t rc522_get_stats(const rc522_handle_t rc522, rc522_stats_t *out_stats);
+
+esp_err_t rc522_destroy(rc522_handle_t rc522);
+
+#ifdef __cplusplus
+}
+#endif
@@ -0,0 +1,30 @@
+#pragma once
+
+#include <stdint.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RC522_CRC_A_PRESET (0x6363)
+
+/**
+ * Continue a CRC_A over @p length bytes of @p data, starting from @p crc
+ * (RC522_CRC_A_PRESET for a new frame). The result is appended to the
+ * frame LSB first. Runs on the host too, no reader is needed.
+ */
+uint16_t rc522_crc_a_update(uint16_t crc, const uint8_t *data, size_t length);
+
+/**
+ * CRC_A of a whole frame, the same as the PCD's CalcCRC command with
+ * the 6363h preset the driver sets in ModeReg
+ */
+static inline uint16_t rc522_crc_a(const uint8_t *data, size_t length)
+{
+    return rc522_crc_a_update(RC522_CRC_A_PRESET, data, length);
+}
+
+#ifdef __cplusplus
+}
+#endif
@@ -4,6 +4,7 @@
 #include <esp_event.h>
 #include <inttypes.h>
 #include "freertos/FreeRTOS.h"
+#include <driver/gpio.h>
 #include "rc522_driver.h"
 #include "rc522_picc.h"
 
@@ -38,8 +39,33 @@ typedef struct
     size_t task_stack_size;       /*<! Stack size of rc522 task */
     uint8_t task_priority;        /*<! Priority of rc522 task */
     SemaphoreHandle_t task_mutex; /*<! Mutex for rc522 task */
+
+    /**
+     * GPIO number of the RC522 IRQ pin. Commands then wait for it
+     * instead of polling the interrupt request registers over the bus,
+     * on the task notification of the task running them (the scanner
+     * task, or yours for the PICC functions), which must not use it
+     * otherwise. Set to -1 (or leave 0, GPIO0 is a strapping pin) if the
+     * IRQ pin is not connected.
+     */
+    gpio_num_t irq_io_num;
+
+    /**
+     * Longest time (in milliseconds) between two presence checks while
+     * no PICC is in the field, ie the tag detection latency. The antenna
+     * is switched off between checks and each check is a REQA with a
+     * 1 ms receive timeout. 0 keeps the antenna on and sends a REQA every
+     * 50 ms.
+     */
+    uint16_t detect_interval_ms;
 } rc522_config_t;
 
+typedef struct
+{
+    uint32_t presence_checks; /*<! REQA and WUPA commands sent by the rc522 task */
+    uint32_t rf_on_us;        /*<! Time the antenna was on, wraps around after 71 minutes */
+} rc522_stats_t;
+
 typedef enum
 {
     RC522_EVENT_ANY = ESP_EVENT_ANY_ID,
@@ -17,6 +17,10 @@ typedef esp_err_t (*rc522_driver_reset_handler_t)(const rc522_driver_handle_t dr
 
 typedef esp_err_t (*rc522_driver_uninstall_handler_t)(const rc522_driver_handle_t driver);
 
+typedef esp_err_t (*rc522_driver_acquire_handler_t)(const rc522_driver_handle_t driver);
+
+typedef void (*rc522_driver_release_handler_t)(const rc522_driver_handle_t driver);
+
 struct rc522_driver_handle
 {
     void *config;
@@ -26,6 +30,9 @@ struct rc522_driver_handle
     rc522_driver_receive_handler_t receive;
     rc522_driver_reset_handler_t reset;
     rc522_driver_uninstall_handler_t uninstall;
+    rc522_driver_acquire_handler_t acquire; /*<! Optional, NULL if the bus is never held */
+    rc522_driver_release_handler_t release; /*<! Optional, NULL if the bus is never held */
+    uint8_t holds;                          /*<! Nesting depth of rc522_driver_acquire() */
 };
 
 esp_err_t rc522_driver_init_rst_pin(gpio_num_t rst_io_num);
@@ -36,6 +43,22 @@ esp_err_t rc522_driver_send(const rc522_driver_handle_t driver, uint8_t address,
 
 esp_err_t rc522_driver_receive(const rc522_driver_handle_t driver, uint8_t address, rc522_bytes_t *bytes);
 
+/**
+ * Hold the bus until the matching rc522_driver_release(), so the register
+ * accesses in between go back to back. Calls nest.
+ */
+esp_err_t rc522_driver_acquire(const rc522_driver_handle_t driver);
+
+void rc522_driver_release(const rc522_driver_handle_t driver);
+
+/**
+ * Give the bus back while the PCD is busy, whatever the hold depth.
+ * Returns the depth to hand to rc522_driver_resume().
+ */
+uint8_t rc522_driver_suspend(const rc522_driver_handle_t driver);
+
+esp_err_t rc522_driver_resume(const rc522_driver_handle_t driver, uint8_t holds);
+
 esp_err_t rc522_driver_reset(const rc522_driver_handle_t driver);
 
 esp_err_t rc522_driver_destroy(rc522_driver_handle_t driver);
@@ -9,6 +9,8 @@ extern "C" {
 
 uint32_t rc522_millis();
 
+uint32_t rc522_micros();
+
 void rc522_delay_ms(uint32_t ms);
 
 esp_err_t rc522_buffer_to_hex_str(
@@ -356,6 +356,22 @@ typedef enum
     RC522_PCD_CRC_PRESET_FFFFH = (RC522_PCD_CRC_PRESET_1_BIT | RC522_PCD_CRC_PRESET_0_BIT), /* FFFFh */
 } rc522_pcd_crc_preset_value_t;
 
+enum // RC522_PCD_COM_INT_EN_REG
+{
+    // Signal on pin IRQ is inverted with respect to the Status1Reg register's IRq bit (active low)
+    RC522_PCD_IRQ_INV_BIT = BIT7,
+
+    // Enable bits of the requests in ComIrqReg are the RC522_PCD_*_IRQ_BIT positions
+};
+
+enum // RC522_PCD_DIV_INT_EN_REG
+{
+    // Pin IRQ is a standard CMOS output pin (open drain when cleared)
+    RC522_PCD_IRQ_PUSH_PULL_BIT = BIT7,
+
+    // Enable bits of the requests in DivIrqReg are the RC522_PCD_*_IRQ_BIT positions
+};
+
 enum // RC522_PCD_DIV_INT_REQ_REG
 {
     // The CalcCRC command is active and all data is processed (CRC calculation is done)
@@ -425,10 +441,38 @@ typedef union
 
 esp_err_t rc522_pcd_reset(const rc522_handle_t rc522, uint32_t timeout_ms);
 
+esp_err_t rc522_pcd_tx_enable(const rc522_handle_t rc522);
+
+esp_err_t rc522_pcd_tx_disable(const rc522_handle_t rc522);
+
+/**
+ * Time the PCD waits for an answer after the end of a transmission,
+ * in steps of 25us. Nothing is written if it is already set.
+ */
+esp_err_t rc522_pcd_set_rx_timeout(const rc522_handle_t rc522, uint32_t timeout_us);
+
 esp_err_t rc522_pcd_calculate_crc(const rc522_handle_t rc522, const rc522_bytes_t *bytes, rc522_pcd_crc_t *result);
 
 esp_err_t rc522_pcd_init(const rc522_handle_t rc522);
 
+esp_err_t rc522_pcd_irq_install(const rc522_handle_t rc522);
+
+void rc522_pcd_irq_uninstall(const rc522_handle_t rc522);
+
+/**
+ * Pass only @c com_irqs (ComIrqReg) and @c div_irqs (DivIrqReg) to the IRQ pin for
+ * the command about to start. Their request bits must be cleared, so that the pin
+ * is high and the request makes an edge. No-op without IRQ pin.
+ */
+esp_err_t rc522_pcd_irq_arm(const rc522_handle_t rc522, uint8_t com_irqs, uint8_t div_irqs);
+
+/**
+ * Wait for the IRQ pin until @c deadline_ms (rc522_millis), or just yield without
+ * IRQ pin; the caller reads the request register again either way. The bus is
+ * given back meanwhile.
+ */
+esp_err_t rc522_pcd_wait_for_irq(const rc522_handle_t rc522, uint32_t deadline_ms);
+
 esp_err_t rc522_pcd_firmware(const rc522_handle_t rc522, rc522_pcd_firmware_t *result);
 
 char *rc522_pcd_firmware_name(rc522_pcd_firmware_t firmware);
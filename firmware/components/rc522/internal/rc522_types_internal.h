@@ -5,7 +5,9 @@
 #include <esp_bit_defs.h>
 #include <freertos/FreeRTOS.h>
 #include <freertos/event_groups.h>
+#include <esp_timer.h>
 #include "rc522_types.h"
+#include "rc522.h"
 #include "rc522_picc.h"
 
 #ifdef __cplusplus
@@ -19,7 +21,14 @@ extern "C" {
 #define RC522_TASK_STACK_SIZE_DEFAULT  (4 * 1024)
 #define RC522_TASK_PRIORITY_DEFAULT    (3)
 
+#define RC522_DETECT_INTERVAL_MS_MIN   (20)
+#define RC522_RF_SETTLE_MS             (5) /*<! ISO 14443-3: unmodulated field before the first command */
+#define RC522_PRESENCE_TIMEOUT_US      (1000)
+#define RC522_RX_TIMEOUT_US_DEFAULT    (25000)
+
 #define RC522_TASK_STOPPED_BIT (BIT0)
+#define RC522_TASK_WAKE_BIT    (BIT1)
+#define RC522_RF_SETTLED_BIT   (BIT2)
 
 #define RC522_LOG_LEVEL LOG_LOCAL_LEVEL
 
@@ -40,6 +49,15 @@ struct rc522
     rc522_state_t state;                  /*<! Current state */
     rc522_picc_t picc;
     EventGroupHandle_t bits;
+    esp_timer_handle_t rf_settle_timer; /*<! Sets RC522_RF_SETTLED_BIT after RC522_RF_SETTLE_MS */
+    TaskHandle_t irq_task; /*<! Task woken by the IRQ pin */
+    bool rf_on;            /*<! Antenna drivers TX1 and TX2 enabled */
+    uint32_t rf_on_at_us;  /*<! Time the antenna was last switched on */
+    uint16_t timer_reload; /*<! Receive timeout currently in TReloadReg */
+    rc522_stats_t stats;
+    rc522_picc_state_callback_t picc_state_callback;
+    void *picc_state_callback_ctx;
+    uint8_t event_handlers; /*<! Registered through rc522_register_events() */
 };
 
 typedef struct
@@ -0,0 +1,273 @@
+#include <string.h>
+#include <esp_attr.h>
+#include <esp_heap_caps.h>
+#include "sdkconfig.h"
+#include "rc522_helpers_internal.h"
+#include "rc522_types_internal.h"
+#include "rc522_driver_internal.h"
+#include "driver/rc522_spi.h"
+
+RC522_LOG_DEFINE_BASE();
+
+// MFRC522 FIFO size, the longest burst worth doing in one transaction
+#define RC522_SPI_BURST_MAX (64)
+
+/**
+ * Address byte in front of every frame: read/write bit, 6-bit register
+ * address, and 0 in the LSB
+ */
+#define RC522_SPI_ADDRESS_BYTE(rw, address) (((rw) << 7) | (((address) & 0x3F) << 1))
+
+typedef struct
+{
+    spi_device_handle_t handle;
+    WORD_ALIGNED_ATTR uint8_t tx[RC522_SPI_BURST_MAX + 1];
+    WORD_ALIGNED_ATTR uint8_t rx[RC522_SPI_BURST_MAX + 1];
+} rc522_spi_device_t;
+
+static esp_err_t rc522_spi_install(const rc522_driver_handle_t driver)
+{
+    RC522_CHECK(driver == NULL);
+    RC522_CHECK(driver->config == NULL);
+
+    rc522_spi_config_t *conf = (rc522_spi_config_t *)(driver->config);
+
+    if (conf->bus_config) {
+        // overwrite bus config
+        conf->bus_config->quadwp_io_num = -1;
+        conf->bus_config->quadhd_io_num = -1;
+
+        RC522_RETURN_ON_ERROR(spi_bus_initialize(conf->host_id, conf->bus_config, conf->dma_chan));
+    }
+    else {
+        RC522_LOGD("skips spi bus initialization");
+    }
+
+    // {{ overwrite device config
+    if (conf->dev_config.clock_speed_hz == 0) {
+        conf->dev_config.clock_speed_hz = 5000000;
+    }
+
+    conf->dev_config.mode = 0;
+
+    if (conf->dev_config.queue_size == 0) {
+        conf->dev_config.queue_size = 7;
+    }
+
+    // Full-duplex frames: a burst read clocks the next address out while
+    // the previous register value comes in
+    conf->dev_config.flags &= ~SPI_DEVICE_HALFDUPLEX;
+    conf->dev_config.command_bits = 0;
+    conf->dev_config.address_bits = 0;
+    conf->dev_config.dummy_bits = 0;
+    // }}
+
+    // The frame buffers are used directly by the SPI DMA
+    rc522_spi_device_t *dev = heap_caps_calloc(1, sizeof(rc522_spi_device_t), MALLOC_CAP_DMA);
+    ESP_RETURN_ON_FALSE(dev != NULL, ESP_ERR_NO_MEM, TAG, "nomem");
+
+    esp_err_t ret = spi_bus_add_device(conf->host_id, &conf->dev_config, &dev->handle);
+
+    if (ret != ESP_OK) {
+        free(dev);
+        RC522_RETURN_ON_ERROR(ret);
+    }
+
+    driver->device = dev;
+
+    if (conf->rst_io_num > GPIO_NUM_NC) {
+        RC522_RETURN_ON_ERROR(rc522_driver_init_rst_pin(conf->rst_io_num));
+    }
+
+    return ESP_OK;
+}
+
+static inline esp_err_t rc522_spi_bus_acquire(const rc522_spi_config_t *conf)
+{
+    return conf->bus_acquire ? conf->bus_acquire(conf->bus_ctx) : ESP_OK;
+}
+
+static inline void rc522_spi_bus_release(const rc522_spi_config_t *conf)
+{
+    if (conf->bus_release) {
+        conf->bus_release(conf->bus_ctx);
+    }
+}
+
+/**
+ * Takes the shared bus (bus_acquire hook) and then the SPI host for this
+ * device only, so the polling transactions in between skip the bus lock.
+ * rc522_driver_acquire() keeps the nesting count.
+ */
+static esp_err_t rc522_spi_acquire(const rc522_driver_handle_t driver)
+{
+    RC522_CHECK(driver == NULL);
+    RC522_CHECK(driver->device == NULL);
+
+    rc522_spi_device_t *dev = (rc522_spi_device_t *)(driver->device);
+    rc522_spi_config_t *conf = (rc522_spi_config_t *)(driver->config);
+
+    RC522_RETURN_ON_ERROR(rc522_spi_bus_acquire(conf));
+
+    esp_err_t ret = spi_device_acquire_bus(dev->handle, portMAX_DELAY);
+
+    if (ret != ESP_OK) {
+        rc522_spi_bus_release(conf);
+    }
+
+    return ret;
+}
+
+static void rc522_spi_release(const rc522_driver_handle_t driver)
+{
+    rc522_spi_device_t *dev = (rc522_spi_device_t *)(driver->device);
+
+    spi_device_release_bus(dev->handle);
+    rc522_spi_bus_release((rc522_spi_config_t *)(driver->config));
+}
+
+/**
+ * One frame of tx_length bytes from dev->tx, received into dev->rx.
+ * The address byte goes to the transaction's user field for pre_cb/post_cb.
+ */
+static esp_err_t rc522_spi_transmit(rc522_spi_device_t *dev, size_t tx_length, bool receive)
+{
+    return spi_device_polling_transmit(dev->handle,
+        &(spi_transaction_t) {
+            .length = 8 * tx_length,
+            .tx_buffer = dev->tx,
+            .rx_buffer = receive ? dev->rx : NULL,
+            .user = (void *)(uintptr_t)(dev->tx[0]),
+        });
+}
+
+static esp_err_t rc522_spi_send(const rc522_driver_handle_t driver, uint8_t address, const rc522_bytes_t *bytes)
+{
+    RC522_CHECK(driver == NULL);
+    RC522_CHECK(driver->device == NULL);
+    RC522_CHECK_BYTES(bytes);
+
+    rc522_spi_device_t *dev = (rc522_spi_device_t *)(driver->device);
+    RC522_RETURN_ON_ERROR(rc522_driver_acquire(driver));
+
+    esp_err_t ret = ESP_OK;
+
+    // The MFRC522 writes every byte after the address to the same register
+    for (uint8_t i = 0; i < bytes->length && ret == ESP_OK;) {
+        uint8_t n = bytes->length - i;
+
+        if (n > RC522_SPI_BURST_MAX) {
+            n = RC522_SPI_BURST_MAX;
+        }
+
+        dev->tx[0] = RC522_SPI_ADDRESS_BYTE(RC522_SPI_WRITE, address);
+        memcpy(dev->tx + 1, bytes->ptr + i, n);
+
+        ret = rc522_spi_transmit(dev, 1 + n, false);
+        i += n;
+    }
+
+    rc522_driver_release(driver);
+
+    return ret;
+}
+
+static esp_err_t rc522_spi_receive(const rc522_driver_handle_t driver, uint8_t address, rc522_bytes_t *bytes)
+{
+    RC522_CHECK(driver == NULL);
+    RC522_CHECK(driver->device == NULL);
+    RC522_CHECK_BYTES(bytes);
+
+    rc522_spi_device_t *dev = (rc522_spi_device_t *)(driver->device);
+    RC522_RETURN_ON_ERROR(rc522_driver_acquire(driver));
+
+#if CONFIG_RC522_SPI_BURST
+    const uint8_t burst_max = RC522_SPI_BURST_MAX;
+#else
+    const uint8_t burst_max = 1;
+#endif
+
+    esp_err_t ret = ESP_OK;
+
+    // Repeated address read: the address is sent once per byte and a 0x00
+    // ends the burst. Each byte comes in while the next address goes out,
+    // so the first one received is discarded.
+    for (uint8_t i = 0; i < bytes->length && ret == ESP_OK;) {
+        uint8_t n = bytes->length - i;
+
+        if (n > burst_max) {
+            n = burst_max;
+        }
+
+        memset(dev->tx, RC522_SPI_ADDRESS_BYTE(RC522_SPI_READ, address), n);
+        dev->tx[n] = 0x00;
+
+        if ((ret = rc522_spi_transmit(dev, n + 1, true)) == ESP_OK) {
+            memcpy(bytes->ptr + i, dev->rx + 1, n);
+        }
+
+        i += n;
+    }
+
+    rc522_driver_release(driver);
+
+    return ret;
+}
+
+static esp_err_t rc522_spi_reset(const rc522_driver_handle_t driver)
+{
+    RC522_CHECK(driver == NULL);
+    RC522_CHECK(driver->config == NULL);
+
+    rc522_spi_config_t *conf = (rc522_spi_config_t *)(driver->config);
+
+    if (conf->rst_io_num < 0) {
+        return RC522_ERR_RST_PIN_UNUSED;
+    }
+
+    RC522_RETURN_ON_ERROR(gpio_set_level(conf->rst_io_num, RC522_DRIVER_HARD_RST_PIN_PWR_DOWN_LEVEL));
+    rc522_delay_ms(RC522_DRIVER_HARD_RST_PULSE_DURATION_MS);
+    RC522_RETURN_ON_ERROR(gpio_set_level(conf->rst_io_num, !RC522_DRIVER_HARD_RST_PIN_PWR_DOWN_LEVEL));
+    rc522_delay_ms(RC522_DRIVER_HARD_RST_PULSE_DURATION_MS);
+
+    return ESP_OK;
+}
+
+static esp_err_t rc522_spi_uninstall(const rc522_driver_handle_t driver)
+{
+    RC522_CHECK(driver == NULL);
+    RC522_CHECK(driver->device == NULL);
+    RC522_CHECK(driver->config == NULL);
+
+    rc522_spi_device_t *dev = (rc522_spi_device_t *)(driver->device);
+
+    RC522_RETURN_ON_ERROR(spi_bus_remove_device(dev->handle));
+    free(dev);
+    driver->device = NULL;
+
+    rc522_spi_config_t *conf = (rc522_spi_config_t *)(driver->config);
+
+    if (conf->bus_config) {
+        RC522_RETURN_ON_ERROR(spi_bus_free(conf->host_id));
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t rc522_spi_create(const rc522_spi_config_t *config, rc522_driver_handle_t *driver)
+{
+    RC522_CHECK(config == NULL);
+    RC522_CHECK(driver == NULL);
+
+    RC522_RETURN_ON_ERROR(rc522_driver_create(config, sizeof(rc522_spi_config_t), driver));
+
+    (*driver)->install = rc522_spi_install;
+    (*driver)->send = rc522_spi_send;
+    (*driver)->receive = rc522_spi_receive;
+    (*driver)->reset = rc522_spi_reset;
+    (*driver)->uninstall = rc522_spi_uninstall;
+    (*driver)->acquire = rc522_spi_acquire;
+    (*driver)->release = rc522_spi_release;
+
+    return ESP_OK;
+}
@@ -49,6 +49,7 @@
 #include "rc522_helpers_internal.h"
 #include "rc522_pcd_internal.h"
 #include "rc522_picc_internal.h"
+#include "rc522_driver_internal.h"
 #include "picc/rc522_mifare.h"
 
 RC522_LOG_DEFINE_BASE();
@@ -221,6 +222,50 @@ esp_err_t rc522_mifare_read(const rc522_handle_t rc522, const rc522_picc_t *picc
     return ESP_OK;
 }
 
+esp_err_t rc522_mifare_read_blocks(const rc522_handle_t rc522, const rc522_picc_t *picc,
+    const rc522_mifare_key_t *key, uint8_t first_block, uint16_t block_count, uint8_t *out_buffer)
+{
+    RC522_CHECK(rc522 == NULL);
+    RC522_CHECK(picc == NULL);
+    RC522_CHECK(key == NULL);
+    RC522_CHECK(out_buffer == NULL);
+
+    rc522_mifare_desc_t desc;
+    RC522_RETURN_ON_ERROR(rc522_mifare_get_desc(picc, &desc));
+    RC522_CHECK(block_count == 0 || first_block + block_count > desc.number_of_blocks);
+
+    RC522_LOGD("MIFARE READ BLOCKS (first_block=%02" RC522_X ", block_count=%d)", first_block, block_count);
+
+    // One hold for the whole range; rc522_pcd_wait_for_irq() still gives the
+    // bus back while the PICC answers
+#if CONFIG_RC522_SPI_BURST
+    RC522_RETURN_ON_ERROR(rc522_driver_acquire(rc522->config->driver));
+#endif
+
+    esp_err_t ret = ESP_OK;
+    uint8_t authenticated_sector = RC522_MIFARE_SECTOR_INDEX_MAX + 1; // None yet
+
+    for (uint16_t i = 0; i < block_count && ret == ESP_OK; i++) {
+        uint8_t block_address = first_block + i;
+        uint8_t sector_index = rc522_mifare_get_sector_index_by_block_address(block_address);
+
+        if (sector_index != authenticated_sector) {
+            ret = rc522_mifare_auth(rc522, picc, block_address, key);
+            authenticated_sector = sector_index;
+        }
+
+        if (ret == ESP_OK) {
+            ret = rc522_mifare_read(rc522, picc, block_address, out_buffer + i * RC522_MIFARE_BLOCK_SIZE);
+        }
+    }
+
+#if CONFIG_RC522_SPI_BURST
+    rc522_driver_release(rc522->config->driver);
+#endif
+
+    return ret;
+}
+
 static esp_err_t rc522_mifare_send(const rc522_handle_t rc522, const uint8_t *send_data, uint8_t send_length)
 {
     RC522_CHECK(send_data == NULL);
@@ -438,6 +483,10 @@ esp_err_t rc522_mifare_get_desc(const rc522_picc_t *picc, rc522_mifare_desc_t *o
 
     RC522_RETURN_ON_ERROR(rc522_mifare_get_number_of_sectors(picc->type, &desc.number_of_sectors));
 
+    // 4 blocks in each of the first 32 sectors, 16 in the rest (4K)
+    desc.number_of_blocks = desc.number_of_sectors <= 32 ? desc.number_of_sectors * 4
+                                                         : 128 + (desc.number_of_sectors - 32) * 16;
+
     memcpy(out_mifare_desc, &desc, sizeof(rc522_mifare_desc_t));
 
     return ESP_OK;
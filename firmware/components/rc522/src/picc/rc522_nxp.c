@@ -45,7 +45,7 @@ inline bool rc522_nxp_type_has_write(rc522_picc_type_t type)
 }
 
 // FAST_READ supported?
-inline bool rc522_nxp_type_has_fast_read(rc522_picc_type_t type)
+bool rc522_nxp_type_has_fast_read(rc522_picc_type_t type)
 {
     switch (type) {
         case RC522_PICC_TYPE_MIFARE_UL_EV1_1:
@@ -34,6 +34,10 @@ static esp_err_t rc522_clone_config(const rc522_config_t *config, rc522_config_t
         config_clone->poll_interval_ms = RC522_POLL_INTERVAL_MS_DEFAULT;
     }
 
+    if (config_clone->detect_interval_ms != 0 && config_clone->detect_interval_ms < RC522_DETECT_INTERVAL_MS_MIN) {
+        config_clone->detect_interval_ms = RC522_DETECT_INTERVAL_MS_MIN;
+    }
+
     if (config_clone->task_stack_size == 0) {
         config_clone->task_stack_size = RC522_TASK_STACK_SIZE_DEFAULT;
     }
@@ -54,7 +58,11 @@ esp_err_t rc522_register_events(
     RC522_CHECK(rc522 == NULL);
     RC522_CHECK(event_handler == NULL);
 
-    return esp_event_handler_register_with(rc522->event_handle, RC522_EVENTS, event, event_handler, event_handler_arg);
+    RC522_RETURN_ON_ERROR(
+        esp_event_handler_register_with(rc522->event_handle, RC522_EVENTS, event, event_handler, event_handler_arg));
+    rc522->event_handlers++;
+
+    return ESP_OK;
 }
 
 esp_err_t rc522_unregister_events(const rc522_handle_t rc522, rc522_event_t event, esp_event_handler_t event_handler)
@@ -62,7 +70,25 @@ esp_err_t rc522_unregister_events(const rc522_handle_t rc522, rc522_event_t even
     RC522_CHECK(rc522 == NULL);
     RC522_CHECK(event_handler == NULL);
 
-    return esp_event_handler_unregister_with(rc522->event_handle, RC522_EVENTS, event, event_handler);
+    RC522_RETURN_ON_ERROR(esp_event_handler_unregister_with(rc522->event_handle, RC522_EVENTS, event, event_handler));
+
+    if (rc522->event_handlers > 0) {
+        rc522->event_handlers--;
+    }
+
+    return ESP_OK;
+}
+
+esp_err_t rc522_set_picc_state_callback(rc522_handle_t rc522, rc522_picc_state_callback_t callback, void *ctx)
+{
+    RC522_CHECK(rc522 == NULL);
+
+    // The rc522 task reads both without a lock, keep the pair consistent
+    rc522->picc_state_callback = NULL;
+    rc522->picc_state_callback_ctx = ctx;
+    rc522->picc_state_callback = callback;
+
+    return ESP_OK;
 }
 
 esp_err_t rc522_start(rc522_handle_t rc522)
@@ -79,6 +105,7 @@ esp_err_t rc522_start(rc522_handle_t rc522)
     if (rc522->state == RC522_STATE_PAUSED) {
         // Scanning has been paused. No need for reinitialization. Just resume
         rc522->state = RC522_STATE_POLLING;
+        xEventGroupSetBits(rc522->bits, RC522_TASK_WAKE_BIT);
         return ESP_OK;
     }
 
@@ -86,6 +113,10 @@ esp_err_t rc522_start(rc522_handle_t rc522)
     ESP_RETURN_ON_ERROR(rc522_pcd_rw_test(rc522), TAG, "rw test failed");
     ESP_RETURN_ON_ERROR(rc522_pcd_init(rc522), TAG, "unable to init pcd");
 
+    // rc522_pcd_init() has switched the antenna on
+    rc522->rf_on = true;
+    rc522->rf_on_at_us = rc522_micros();
+
     rc522->state = RC522_STATE_POLLING;
 
     return ESP_OK;
@@ -106,12 +137,39 @@ esp_err_t rc522_pause(rc522_handle_t rc522)
     return ESP_OK;
 }
 
+esp_err_t rc522_get_stats(const rc522_handle_t rc522, rc522_stats_t *out_stats)
+{
+    RC522_CHECK(rc522 == NULL);
+    RC522_CHECK(out_stats == NULL);
+
+    rc522_stats_t stats = rc522->stats;
+
+    if (rc522->rf_on) {
+        stats.rf_on_us += rc522_micros() - rc522->rf_on_at_us;
+    }
+
+    *out_stats = stats;
+
+    return ESP_OK;
+}
+
 /**
  * @brief Exit and delete the task
  */
 inline static void rc522_request_task_to_exit(const rc522_handle_t rc522)
 {
     rc522->exit_requested = true; // task will delete itself
+
+    if (rc522->bits) {
+        xEventGroupSetBits(rc522->bits, RC522_TASK_WAKE_BIT);
+    }
+}
+
+static void rc522_rf_settled(void *arg)
+{
+    rc522_handle_t rc522 = (rc522_handle_t)arg;
+
+    xEventGroupSetBits(rc522->bits, RC522_RF_SETTLED_BIT);
 }
 
 esp_err_t rc522_create(const rc522_config_t *config, rc522_handle_t *out_rc522)
@@ -127,6 +185,7 @@ esp_err_t rc522_create(const rc522_config_t *config, rc522_handle_t *out_rc522)
     esp_err_t ret = ESP_OK;
 
     ESP_GOTO_ON_ERROR(rc522_clone_config(config, &(rc522->config)), _error, TAG, "clone config failed");
+    ESP_GOTO_ON_ERROR(rc522_pcd_irq_install(rc522), _error, TAG, "irq pin install failed");
 
     esp_event_loop_args_t event_args = {
         .queue_size = 1,
@@ -136,6 +195,18 @@ esp_err_t rc522_create(const rc522_config_t *config, rc522_handle_t *out_rc522)
     rc522->bits = xEventGroupCreate();
     ESP_GOTO_ON_FALSE(rc522->bits != NULL, ESP_ERR_NO_MEM, _error, TAG, "nomem");
 
+    esp_timer_create_args_t settle_timer_args = {
+        .callback = rc522_rf_settled,
+        .arg = rc522,
+        .dispatch_method = ESP_TIMER_TASK,
+        .name = "rc522_rf_settle",
+    };
+
+    ESP_GOTO_ON_ERROR(esp_timer_create(&settle_timer_args, &rc522->rf_settle_timer),
+        _error,
+        TAG,
+        "Failed to create settle timer");
+
     ESP_GOTO_ON_ERROR(esp_event_loop_create(&event_args, &rc522->event_handle),
         _error,
         TAG,
@@ -175,6 +246,16 @@ esp_err_t rc522_destroy(rc522_handle_t rc522)
 
     if (rc522->bits) {
         xEventGroupWaitBits(rc522->bits, RC522_TASK_STOPPED_BIT, pdFALSE, pdTRUE, portMAX_DELAY);
+    }
+
+    // Timer callback sets a bit, so the timer goes before the event group
+    if (rc522->rf_settle_timer) {
+        esp_timer_stop(rc522->rf_settle_timer);
+        esp_timer_delete(rc522->rf_settle_timer);
+        rc522->rf_settle_timer = NULL;
+    }
+
+    if (rc522->bits) {
         vEventGroupDelete(rc522->bits);
         rc522->bits = NULL;
     }
@@ -188,6 +269,7 @@ esp_err_t rc522_destroy(rc522_handle_t rc522)
     }
 
     if (rc522->config) {
+        rc522_pcd_irq_uninstall(rc522);
         free(rc522->config);
         rc522->config = NULL;
     }
@@ -199,11 +281,72 @@ esp_err_t rc522_destroy(rc522_handle_t rc522)
 
 esp_err_t rc522_dispatch_event(const rc522_handle_t rc522, rc522_event_t event, const void *data, size_t data_size)
 {
-    RC522_RETURN_ON_ERROR(esp_event_post_to(rc522->event_handle, RC522_EVENTS, event, data, data_size, portMAX_DELAY));
+    if (rc522->event_handlers == 0) {
+        return ESP_OK;
+    }
+
+    // The loop is run right after each post, so its queue is empty here
+    // and there is nothing to wait for
+    RC522_RETURN_ON_ERROR(esp_event_post_to(rc522->event_handle, RC522_EVENTS, event, data, data_size, 0));
 
     return esp_event_loop_run(rc522->event_handle, 0);
 }
 
+/**
+ * Presence checks with the antenna off in between. Not for a halted PICC:
+ * switching the field off resets it, and it would then answer REQA.
+ */
+inline static bool rc522_is_detecting(const rc522_handle_t rc522)
+{
+    return rc522->config->detect_interval_ms != 0 && rc522->picc.state == RC522_PICC_STATE_IDLE;
+}
+
+static esp_err_t rc522_set_rf(const rc522_handle_t rc522, bool on)
+{
+    if (on == rc522->rf_on) {
+        return ESP_OK;
+    }
+
+    if (on) {
+        RC522_RETURN_ON_ERROR(rc522_pcd_tx_enable(rc522));
+        rc522->rf_on_at_us = rc522_micros();
+    }
+    else {
+        RC522_RETURN_ON_ERROR(rc522_pcd_tx_disable(rc522));
+        rc522->stats.rf_on_us += rc522_micros() - rc522->rf_on_at_us;
+    }
+
+    rc522->rf_on = on;
+
+    return ESP_OK;
+}
+
+/**
+ * @brief Sleep until the timeout, rc522_start() or rc522_destroy()
+ */
+inline static void rc522_task_sleep(const rc522_handle_t rc522, TickType_t ticks)
+{
+    xEventGroupWaitBits(rc522->bits, RC522_TASK_WAKE_BIT, pdTRUE, pdFALSE, ticks);
+}
+
+/**
+ * @brief Block for RC522_RF_SETTLE_MS after the field turned on
+ *
+ * A one-shot esp_timer wakes the task, so the field is not kept on until the next tick
+ * (10-20 ms at 100 Hz) and the CPU is free meanwhile.
+ */
+static void rc522_rf_settle(const rc522_handle_t rc522)
+{
+    xEventGroupClearBits(rc522->bits, RC522_RF_SETTLED_BIT);
+
+    if (esp_timer_start_once(rc522->rf_settle_timer, RC522_RF_SETTLE_MS * 1000) != ESP_OK) {
+        vTaskDelay(pdMS_TO_TICKS(RC522_RF_SETTLE_MS) + 1);
+        return;
+    }
+
+    xEventGroupWaitBits(rc522->bits, RC522_RF_SETTLED_BIT, pdTRUE, pdFALSE, portMAX_DELAY);
+}
+
 void rc522_task(void *arg)
 {
     esp_err_t ret = ESP_OK;
@@ -228,12 +371,33 @@ void rc522_task(void *arg)
         }
 
         if (rc522->state != RC522_STATE_POLLING) {
+            // With presence checks the field goes off until rc522_start(),
+            // which ends the session of any PICC in it
+            if (rc522->config->detect_interval_ms != 0 && rc522->rf_on
+                && (rc522->config->task_mutex == NULL
+                    || xSemaphoreTake(rc522->config->task_mutex, pdMS_TO_TICKS(mutex_take_timeout_ms)) == pdTRUE)) {
+                mutex_taken = rc522->config->task_mutex != NULL;
+
+                if (rc522->picc.state != RC522_PICC_STATE_IDLE) {
+                    rc522_picc_set_state(rc522, &rc522->picc, RC522_PICC_STATE_IDLE, true);
+                }
+
+                rc522_set_rf(rc522, false);
+                continue;
+            }
+
             // waiting for state change to polling
-            rc522_delay_ms(100);
+            rc522_task_sleep(rc522, portMAX_DELAY);
             continue;
         }
 
-        rc522_delay_ms(task_delay_ms);
+        bool detecting = rc522_is_detecting(rc522);
+
+        rc522_task_sleep(rc522, pdMS_TO_TICKS(detecting ? rc522->config->detect_interval_ms : task_delay_ms));
+
+        if (rc522->state != RC522_STATE_POLLING) {
+            continue;
+        }
 
         if (rc522->config->task_mutex != NULL) {
             if (xSemaphoreTake(rc522->config->task_mutex, pdMS_TO_TICKS(mutex_take_timeout_ms)) == pdTRUE) {
@@ -250,7 +414,28 @@ void rc522_task(void *arg)
         if (rc522->picc.state == RC522_PICC_STATE_IDLE || rc522->picc.state == RC522_PICC_STATE_HALT) {
             rc522_picc_atqa_desc_t atqa;
 
+            if (detecting && !rc522->rf_on) {
+                if (rc522_set_rf(rc522, true) != ESP_OK) {
+                    continue;
+                }
+
+                rc522_rf_settle(rc522);
+            }
+
+            // A PICC answers REQA within 100us, the long timeout is for
+            // the commands that follow
+            if (rc522_pcd_set_rx_timeout(rc522, detecting ? RC522_PRESENCE_TIMEOUT_US : RC522_RX_TIMEOUT_US_DEFAULT)
+                != ESP_OK) {
+                continue;
+            }
+
+            rc522->stats.presence_checks++;
+
             if (rc522->picc.state == RC522_PICC_STATE_IDLE && ((ret = rc522_picc_reqa(rc522, &atqa)) != ESP_OK)) {
+                if (detecting) {
+                    rc522_set_rf(rc522, false);
+                }
+
                 continue;
             }
 
@@ -261,6 +446,10 @@ void rc522_task(void *arg)
             // card is present
             rc522->picc.atqa = atqa;
 
+            if (rc522_pcd_set_rx_timeout(rc522, RC522_RX_TIMEOUT_US_DEFAULT) != ESP_OK) {
+                continue;
+            }
+
             if (rc522->picc.state == RC522_PICC_STATE_IDLE) {
                 rc522_picc_set_state(rc522, &rc522->picc, RC522_PICC_STATE_READY, true);
             }
@@ -286,6 +475,11 @@ void rc522_task(void *arg)
                 }
 
                 rc522_picc_set_state(rc522, &rc522->picc, RC522_PICC_STATE_IDLE, true);
+
+                if (rc522_is_detecting(rc522)) {
+                    rc522_set_rf(rc522, false);
+                }
+
                 continue;
             }
 
@@ -310,6 +504,11 @@ void rc522_task(void *arg)
                 && ((rc522_millis() - picc_heartbeat_failure_at_ms) > picc_heartbeat_failure_threshold_ms)) {
                 picc_heartbeat_failure_at_ms = 0;
                 rc522_picc_set_state(rc522, &rc522->picc, RC522_PICC_STATE_IDLE, true);
+
+                if (rc522_is_detecting(rc522)) {
+                    rc522_set_rf(rc522, false);
+                }
+
                 continue;
             }
 
@@ -46,6 +46,63 @@ inline esp_err_t rc522_driver_receive(const rc522_driver_handle_t driver, uint8_
     return driver->receive(driver, address, bytes);
 }
 
+esp_err_t rc522_driver_acquire(const rc522_driver_handle_t driver)
+{
+    RC522_CHECK(driver == NULL);
+
+    if (driver->acquire == NULL) {
+        return ESP_OK;
+    }
+
+    if (driver->holds == 0) {
+        RC522_RETURN_ON_ERROR(driver->acquire(driver));
+    }
+
+    driver->holds++;
+
+    return ESP_OK;
+}
+
+void rc522_driver_release(const rc522_driver_handle_t driver)
+{
+    if (driver == NULL || driver->release == NULL || driver->holds == 0) {
+        return;
+    }
+
+    if (--driver->holds == 0) {
+        driver->release(driver);
+    }
+}
+
+uint8_t rc522_driver_suspend(const rc522_driver_handle_t driver)
+{
+    if (driver == NULL || driver->holds == 0) {
+        return 0;
+    }
+
+    uint8_t holds = driver->holds;
+
+    driver->holds = 0;
+    driver->release(driver);
+
+    return holds;
+}
+
+esp_err_t rc522_driver_resume(const rc522_driver_handle_t driver, uint8_t holds)
+{
+    RC522_CHECK(driver == NULL);
+
+    if (holds == 0) {
+        return ESP_OK;
+    }
+
+    // On failure the pending releases are no-ops
+    RC522_RETURN_ON_ERROR(driver->acquire(driver));
+    driver->holds = holds;
+
+    return ESP_OK;
+}
+
 inline esp_err_t rc522_driver_reset(const rc522_driver_handle_t driver)
 {
     RC522_CHECK(driver == NULL);
@@ -99,6 +156,8 @@ esp_err_t rc522_driver_destroy(rc522_driver_handle_t driver)
     driver->send = NULL;
     driver->receive = NULL;
     driver->uninstall = NULL;
+    driver->acquire = NULL;
+    driver->release = NULL;
 
     driver->device = NULL;
 
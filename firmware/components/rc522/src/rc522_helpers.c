@@ -19,6 +19,14 @@ uint32_t rc522_millis()
     return (uint32_t)((now.tv_sec * 1000000 + now.tv_usec) / 1000);
 }
 
+uint32_t rc522_micros()
+{
+    struct timeval now;
+    gettimeofday(&now, NULL);
+
+    return (uint32_t)(now.tv_sec * 1000000 + now.tv_usec);
+}
+
 void rc522_delay_ms(uint32_t ms)
 {
     vTaskDelay(pdMS_TO_TICKS(ms));
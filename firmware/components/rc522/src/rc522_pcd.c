@@ -1,11 +1,17 @@
 #include <esp_system.h>
 #include <esp_check.h>
+#include <sdkconfig.h>
 #include <string.h>
+#include <esp_attr.h>
+#include <driver/gpio.h>
+#include <freertos/FreeRTOS.h>
+#include <freertos/task.h>
 
 #include "rc522_types_internal.h"
 #include "rc522_helpers_internal.h"
 #include "rc522_driver_internal.h"
 #include "rc522_pcd_internal.h"
+#include "rc522_crc.h"
 
 RC522_LOG_DEFINE_BASE();
 
@@ -18,8 +24,16 @@ esp_err_t rc522_pcd_calculate_crc(const rc522_handle_t rc522, const rc522_bytes_
     RC522_CHECK_BYTES(bytes);
     RC522_CHECK(result == NULL);
 
+    rc522_pcd_crc_t crc = { 0 };
+
+#if CONFIG_RC522_SOFTWARE_CRC
+    // The coprocessor costs a dozen register accesses and a wait for
+    // its interrupt, the table lookup under a microsecond
+    crc.value = rc522_crc_a(bytes->ptr, bytes->length);
+#else
     RC522_RETURN_ON_ERROR(rc522_pcd_stop_active_command(rc522));
     RC522_RETURN_ON_ERROR(rc522_pcd_clear_bits(rc522, RC522_PCD_DIV_INT_REQ_REG, RC522_PCD_CRC_IRQ_BIT));
+    RC522_RETURN_ON_ERROR(rc522_pcd_irq_arm(rc522, 0, RC522_PCD_CRC_IRQ_BIT));
     RC522_RETURN_ON_ERROR(rc522_pcd_fifo_flush(rc522));
     RC522_RETURN_ON_ERROR(rc522_pcd_fifo_write(rc522, bytes));
     RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_COMMAND_REG, RC522_PCD_CALC_CRC_CMD));
@@ -36,7 +50,7 @@ esp_err_t rc522_pcd_calculate_crc(const rc522_handle_t rc522, const rc522_bytes_
             break;
         }
 
-        taskYIELD();
+        RC522_RETURN_ON_ERROR(rc522_pcd_wait_for_irq(rc522, deadline_ms));
     }
     while (rc522_millis() < deadline_ms);
 
@@ -44,11 +58,10 @@ esp_err_t rc522_pcd_calculate_crc(const rc522_handle_t rc522, const rc522_bytes_
         return ESP_ERR_TIMEOUT;
     }
 
-    rc522_pcd_crc_t crc = { 0 };
-
     RC522_RETURN_ON_ERROR(rc522_pcd_stop_active_command(rc522));
     RC522_RETURN_ON_ERROR(rc522_pcd_read(rc522, RC522_PCD_CRC_RESULT_MSB_REG, &crc.msb));
     RC522_RETURN_ON_ERROR(rc522_pcd_read(rc522, RC522_PCD_CRC_RESULT_LSB_REG, &crc.lsb));
+#endif
 
     if (RC522_LOG_LEVEL >= ESP_LOG_DEBUG) {
         char debug_buffer[64];
@@ -61,6 +74,106 @@ esp_err_t rc522_pcd_calculate_crc(const rc522_handle_t rc522, const rc522_bytes_
     return ESP_OK;
 }
 
+static inline bool rc522_pcd_has_irq(const rc522_handle_t rc522)
+{
+    return rc522->config->irq_io_num > GPIO_NUM_0;
+}
+
+/**
+ * The MFRC522 pulls its IRQ pin low while an enabled interrupt request is set
+ */
+static void IRAM_ATTR rc522_pcd_irq_isr(void *arg)
+{
+    TaskHandle_t task = ((rc522_handle_t)arg)->irq_task;
+
+    if (task) {
+        BaseType_t woken = pdFALSE;
+        vTaskNotifyGiveFromISR(task, &woken);
+
+        if (woken) {
+            portYIELD_FROM_ISR();
+        }
+    }
+}
+
+esp_err_t rc522_pcd_irq_install(const rc522_handle_t rc522)
+{
+    RC522_CHECK(rc522 == NULL);
+
+    if (!rc522_pcd_has_irq(rc522)) {
+        return ESP_OK;
+    }
+
+    gpio_config_t io_conf = {
+        .intr_type = GPIO_INTR_NEGEDGE,
+        .mode = GPIO_MODE_INPUT,
+        .pin_bit_mask = (1ULL << rc522->config->irq_io_num),
+        .pull_down_en = GPIO_PULLDOWN_DISABLE,
+        .pull_up_en = GPIO_PULLUP_ENABLE,
+    };
+
+    RC522_RETURN_ON_ERROR(gpio_config(&io_conf));
+
+    // Other drivers may have installed the service already
+    esp_err_t ret = gpio_install_isr_service(0);
+
+    if (ret != ESP_OK && ret != ESP_ERR_INVALID_STATE) {
+        RC522_RETURN_ON_ERROR(ret);
+    }
+
+    RC522_RETURN_ON_ERROR(gpio_isr_handler_add(rc522->config->irq_io_num, rc522_pcd_irq_isr, rc522));
+
+    return ESP_OK;
+}
+
+void rc522_pcd_irq_uninstall(const rc522_handle_t rc522)
+{
+    if (rc522 && rc522->config && rc522_pcd_has_irq(rc522)) {
+        gpio_isr_handler_remove(rc522->config->irq_io_num);
+    }
+}
+
+esp_err_t rc522_pcd_irq_arm(const rc522_handle_t rc522, uint8_t com_irqs, uint8_t div_irqs)
+{
+    RC522_CHECK(rc522 == NULL);
+
+    if (!rc522_pcd_has_irq(rc522)) {
+        return ESP_OK;
+    }
+
+    // Both registers every time: a request left enabled and set from the
+    // previous command would hold the pin low and swallow the edge
+    RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_COM_INT_EN_REG, RC522_PCD_IRQ_INV_BIT | com_irqs));
+    RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_DIV_INT_EN_REG, RC522_PCD_IRQ_PUSH_PULL_BIT | div_irqs));
+
+    // Forget wake-ups of earlier commands
+    rc522->irq_task = xTaskGetCurrentTaskHandle();
+    ulTaskNotifyTake(pdTRUE, 0);
+
+    return ESP_OK;
+}
+
+esp_err_t rc522_pcd_wait_for_irq(const rc522_handle_t rc522, uint32_t deadline_ms)
+{
+    RC522_CHECK(rc522 == NULL);
+
+    uint8_t holds = rc522_driver_suspend(rc522->config->driver);
+
+    if (rc522_pcd_has_irq(rc522)) {
+        uint32_t now_ms = rc522_millis();
+
+        if (deadline_ms > now_ms) {
+            // Round up, a wake-up before the deadline would only poll again
+            ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(deadline_ms - now_ms) + 1);
+        }
+    }
+    else {
+        taskYIELD();
+    }
+
+    return rc522_driver_resume(rc522->config->driver, holds);
+}
+
 static esp_err_t rc522_pcd_wait_for_reset(const rc522_handle_t rc522, uint32_t timeout_ms)
 {
     RC522_CHECK(rc522 == NULL);
@@ -123,11 +236,16 @@ esp_err_t rc522_pcd_reset(const rc522_handle_t rc522, uint32_t timeout_ms)
     return ret;
 }
 
-inline static esp_err_t rc522_pcd_tx_enable(const rc522_handle_t rc522)
+esp_err_t rc522_pcd_tx_enable(const rc522_handle_t rc522)
 {
     return rc522_pcd_set_bits(rc522, RC522_PCD_TX_CONTROL_REG, (RC522_PCD_TX2_RF_EN_BIT | RC522_PCD_TX1_RF_EN_BIT));
 }
 
+esp_err_t rc522_pcd_tx_disable(const rc522_handle_t rc522)
+{
+    return rc522_pcd_clear_bits(rc522, RC522_PCD_TX_CONTROL_REG, (RC522_PCD_TX2_RF_EN_BIT | RC522_PCD_TX1_RF_EN_BIT));
+}
+
 static esp_err_t rc522_pcd_configure_timer(const rc522_handle_t rc522, uint8_t mode, uint16_t prescaler)
 {
     uint8_t prescaler_hi = (prescaler >> 8) & 0x0F;
@@ -145,9 +263,26 @@ inline static esp_err_t rc522_pcd_set_timer_reload_value(const rc522_handle_t rc
     RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_TIMER_RELOAD_MSB_REG, (value >> 8) & 0xFF));
     RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_TIMER_RELOAD_LSB_REG, value & 0xFF));
 
+    rc522->timer_reload = value;
+
     return ESP_OK;
 }
 
+esp_err_t rc522_pcd_set_rx_timeout(const rc522_handle_t rc522, uint32_t timeout_us)
+{
+    RC522_CHECK(rc522 == NULL);
+    RC522_CHECK(timeout_us < 25 || timeout_us > 0xFFFF * 25);
+
+    // One timer period is 25us (see rc522_pcd_init)
+    uint16_t value = timeout_us / 25;
+
+    if (value == rc522->timer_reload) {
+        return ESP_OK;
+    }
+
+    return rc522_pcd_set_timer_reload_value(rc522, value);
+}
+
 inline static esp_err_t rc522_pcd_set_rx_gain(const rc522_handle_t rc522, rc522_pcd_rx_gain_t gain)
 {
     return rc522_pcd_set_bits(rc522, RC522_PCD_RF_CFG_REG, gain);
@@ -173,7 +308,7 @@ esp_err_t rc522_pcd_init(const rc522_handle_t rc522)
     RC522_RETURN_ON_ERROR(rc522_pcd_configure_timer(rc522, RC522_PCD_T_AUTO_BIT, 169));
 
     // Reload timer with 0x3E8 = 1000, ie 25ms before timeout.
-    RC522_RETURN_ON_ERROR(rc522_pcd_set_timer_reload_value(rc522, 1000));
+    RC522_RETURN_ON_ERROR(rc522_pcd_set_timer_reload_value(rc522, RC522_RX_TIMEOUT_US_DEFAULT / 25));
 
     RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_TX_ASK_REG, RC522_PCD_FORCE_100_ASK_BIT));
 
@@ -183,6 +318,9 @@ esp_err_t rc522_pcd_init(const rc522_handle_t rc522)
         RC522_PCD_MODE_REG,
         (RC522_PCD_TX_WAIT_RF_BIT | RC522_PCD_POL_MFIN_BIT | RC522_PCD_CRC_PRESET_6363H)));
 
+    // The IRQ pin is push-pull, active low, and stays high until a command arms it
+    RC522_RETURN_ON_ERROR(rc522_pcd_irq_arm(rc522, 0, 0));
+
     // Enable the antenna driver pins TX1 and TX2 (they were disabled by the reset)
     RC522_RETURN_ON_ERROR(rc522_pcd_tx_enable(rc522));
 
@@ -1,12 +1,14 @@
 #include <esp_system.h>
 #include <esp_check.h>
 #include <string.h>
+#include "sdkconfig.h"
 
 #include "rc522_internal.h"
 #include "rc522_types_internal.h"
 #include "rc522_helpers_internal.h"
 #include "rc522_pcd_internal.h"
 #include "rc522_picc_internal.h"
+#include "rc522_driver_internal.h"
 
 RC522_LOG_DEFINE_BASE();
 
@@ -51,10 +53,15 @@ esp_err_t rc522_picc_send(const rc522_handle_t rc522, const rc522_picc_transacti
     RC522_RETURN_ON_ERROR(rc522_pcd_fifo_flush(rc522));
     RC522_RETURN_ON_ERROR(rc522_pcd_fifo_write(rc522, &transaction->bytes));
     RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_BIT_FRAMING_REG, bit_framing));
+    RC522_RETURN_ON_ERROR(
+        rc522_pcd_irq_arm(rc522, transaction->expected_interrupts | RC522_PCD_TIMER_IRQ_BIT, 0));
     RC522_RETURN_ON_ERROR(rc522_pcd_write(rc522, RC522_PCD_COMMAND_REG, transaction->pcd_command));
 
+    // StartSend on top of the framing written above: one write instead of
+    // a read-modify-write of BitFramingReg
     if (transaction->pcd_command == RC522_PCD_TRANSCEIVE_CMD) {
-        RC522_RETURN_ON_ERROR(rc522_pcd_start_data_transmission(rc522));
+        RC522_RETURN_ON_ERROR(
+            rc522_pcd_write(rc522, RC522_PCD_BIT_FRAMING_REG, bit_framing | RC522_PCD_START_SEND_BIT));
     }
 
     // TAuto flag in TModeReg is set.
@@ -77,7 +84,8 @@ esp_err_t rc522_picc_send(const rc522_handle_t rc522, const rc522_picc_transacti
             return RC522_ERR_RX_TIMER_TIMEOUT;
         }
 
-        taskYIELD();
+        // The display gets the bus while the card answers
+        RC522_RETURN_ON_ERROR(rc522_pcd_wait_for_irq(rc522, deadline));
     }
     while (rc522_millis() < deadline);
 
@@ -199,14 +207,28 @@ esp_err_t rc522_picc_transceive(const rc522_handle_t rc522, const rc522_picc_tra
     transaction_clone.pcd_command = RC522_PCD_TRANSCEIVE_CMD;
     transaction_clone.expected_interrupts = RC522_PCD_RX_IRQ_BIT | RC522_PCD_IDLE_IRQ_BIT;
 
+    // One bus hold for the whole command, apart from the wait for the PICC
+    // (see rc522_picc_send). No other device can come in between.
+#if CONFIG_RC522_SPI_BURST
+    RC522_RETURN_ON_ERROR(rc522_driver_acquire(rc522->config->driver));
+#endif
+
     rc522_picc_transaction_context_t context = { 0 };
-    RC522_RETURN_ON_ERROR_SILENTLY(rc522_picc_send(rc522, &transaction_clone, &context));
+    esp_err_t ret = rc522_picc_send(rc522, &transaction_clone, &context);
 
-    if (out_result) {
-        RC522_RETURN_ON_ERROR(rc522_picc_receive(rc522, &context, out_result));
+    if (ret == ESP_OK && out_result) {
+        ret = rc522_picc_receive(rc522, &context, out_result);
+
+        if (ret != ESP_OK) {
+            RC522_LOGE("receive failed (err=%04" RC522_X ")", ret);
+        }
     }
 
-    return ESP_OK;
+#if CONFIG_RC522_SPI_BURST
+    rc522_driver_release(rc522->config->driver);
+#endif
+
+    return ret;
 }
 
 inline static esp_err_t rc522_picc_parse_atqa(uint16_t atqa, rc522_picc_atqa_desc_t *out_atqa)
@@ -731,6 +753,12 @@ esp_err_t rc522_picc_set_state(
     picc->state = new_state;
 
     if (fire_event) {
+        rc522_picc_state_callback_t callback = rc522->picc_state_callback;
+
+        if (callback) {
+            callback(picc, old_state, rc522->picc_state_callback_ctx);
+        }
+
         rc522_picc_state_changed_event_t event_data = {
             .old_state = old_state,
             .picc = picc,
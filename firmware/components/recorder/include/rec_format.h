@@ -0,0 +1,101 @@
+#ifndef REC_FORMAT_H
+#define REC_FORMAT_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Sensor recording stream
+//
+// A stream is the 4 byte magic followed by records:
+//
+//   byte 0     type (bits 7-6) | arg (bits 5-0)
+//   varint     time since the previous record in us (zigzag LEB128)
+//   payload    TICK: pot and accel ADC, 12 bits each, in 3 bytes
+//              EDGE: none (arg = GPIO)
+//              RFID: arg UID bytes
+//              AUTH: 1 byte auth_result_t (an RFID record with arg 63)
+//              PROFILE: rec_profile_t in 28 bytes (an RFID record with arg 62)
+//              GAP:  none (arg = records lost, saturated at 62)
+//
+// TICK carries the turn/RCWL levels in arg. AUTH follows the RFID record
+// of the tag it decided on, once the decision has taken effect; a granted
+// tag's PROFILE comes before it. 0xFF (erased flash) ends the
+// stream. Records are in the order the inputs were seen, which replay
+// relies on; timestamps are only used to set the clock.
+
+#define REC_MAGIC            "EBR2"
+#define REC_MAGIC_LEN        4
+#define REC_MAX_RECORD_LEN   40
+#define REC_END_BYTE         0xFF
+#define REC_GAP_MAX          62
+#define REC_UID_MAX_LEN      10
+#define REC_RFID_ARG_AUTH    63
+#define REC_RFID_ARG_PROFILE 62
+#define REC_PROFILE_LEN      28
+
+typedef enum {
+    REC_TICK = 0, 					// One control pass and the inputs it sampled
+    REC_EDGE, 						// Rising edge on a hall or pedal input
+    REC_RFID, 						// Tag presented
+    REC_GAP, 						// Recorder ring overflowed
+    REC_AUTH, 						// Decision on the last tag, RFID on the wire
+    REC_PROFILE, 					// Motor profile applied, RFID on the wire
+} rec_type_t;
+
+// motor_profile_t as recorded. Gains are stored as the IEEE doubles
+// themselves, so replay runs the exact values.
+typedef struct {
+    uint8_t assist_min;
+    uint8_t assist_max;
+    uint8_t speed_limit_kmh;
+    bool throttle;
+    double kp;
+    double ki;
+    double kd;
+} rec_profile_t;
+
+typedef struct {
+    uint8_t type; 					// rec_type_t
+    int64_t time_us;
+    union {
+        struct {
+            uint16_t pot_raw;
+            uint16_t accel_raw;
+            uint8_t levels; 				// TURN_LEVEL_* / RCWL_LEVEL_* bits
+        } tick;
+        struct {
+            uint8_t pin;
+        } edge;
+        struct {
+            uint8_t uid_len;
+            uint8_t uid[REC_UID_MAX_LEN];
+        } rfid;
+        struct {
+            uint8_t lost;
+        } gap;
+        struct {
+            uint8_t result; 				// auth_result_t
+        } auth;
+        rec_profile_t profile;
+    };
+} rec_event_t;
+
+// Encode one record into out (at least REC_MAX_RECORD_LEN bytes).
+// last_us holds the time of the previous record and is updated.
+// Returns the record length.
+size_t rec_encode(const rec_event_t *ev, int64_t *last_us, uint8_t *out);
+
+// Decode one record. Returns the bytes consumed, 0 at the end of the
+// stream and -1 on a truncated or malformed record.
+int rec_decode(const uint8_t *in, size_t len, int64_t *last_us, rec_event_t *ev);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// REC_FORMAT_H
@@ -0,0 +1,79 @@
+#ifndef RECORDER_H
+#define RECORDER_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include <stddef.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "rec_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Ride recorder: captures the raw control inputs (see rec_format.h) so a
+// ride can be replayed on the host through the same control and UI code.
+//
+// An input and the record describing it must be taken under the caller's
+// own lock, the one that guards the input, so the stream order matches
+// what the control code actually saw:
+//
+//     portENTER_CRITICAL_SAFE(&input_lock);
+//     int64_t now = hal_time_us();
+//     ... update ISR state ...
+//     REC_EDGE(pin, now);
+//     portEXIT_CRITICAL_SAFE(&input_lock);
+
+#if CONFIG_EBIKE_REC_ENABLE
+
+extern volatile bool rec_running;
+
+// Safe from ISRs; each takes the ring lock itself
+void rec_edge(uint8_t pin, int64_t now_us);
+void rec_tick(int64_t now_us, uint16_t pot_raw, uint16_t accel_raw, uint8_t levels);
+
+#define REC_EDGE(pin, now)   do { if (rec_running) rec_edge((pin), (now)); } while (0)
+#define REC_TICK(now, pot, accel, levels) \
+    do { if (rec_running) rec_tick((now), (pot), (accel), (levels)); } while (0)
+
+void rec_rfid(const uint8_t *uid, size_t uid_len, int64_t now_us);
+#define REC_RFID(uid, len, now)  do { if (rec_running) rec_rfid((uid), (len), (now)); } while (0)
+
+// The auth_result_t of the last tag
+void rec_auth(uint8_t result, int64_t now_us);
+#define REC_AUTH(result, now)    do { if (rec_running) rec_auth((result), (now)); } while (0)
+
+// The motor profile the control tick runs from now on
+void rec_profile(const rec_profile_t *profile, int64_t now_us);
+#define REC_PROFILE(profile, now)  do { if (rec_running) rec_profile((profile), (now)); } while (0)
+
+#else
+
+#define REC_EDGE(pin, now)   do { (void)(pin); (void)(now); } while (0)
+#define REC_TICK(now, pot, accel, levels) \
+    do { (void)(now); (void)(pot); (void)(accel); (void)(levels); } while (0)
+#define REC_RFID(uid, len, now)  do { (void)(uid); (void)(len); (void)(now); } while (0)
+#define REC_AUTH(result, now)    do { (void)(result); (void)(now); } while (0)
+#define REC_PROFILE(profile, now)  do { (void)(profile); (void)(now); } while (0)
+
+#endif 				// CONFIG_EBIKE_REC_ENABLE
+
+// Create the drain task. Starts recording if CONFIG_EBIKE_REC_AUTOSTART.
+esp_err_t rec_init(void);
+
+// Start a new stream (erases the flash log) / finish it
+esp_err_t rec_start(void);
+void rec_stop(void);
+
+// Print the flash log as "@R" lines for tools/rec_extract.py
+void rec_dump(void);
+
+// Register the "rec" console command (call after the REPL is created)
+esp_err_t rec_register_console_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// RECORDER_H
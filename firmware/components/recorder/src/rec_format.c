@@ -0,0 +1,145 @@
+#include "rec_format.h"
+#include <string.h>
+
+static size_t put_varint(uint8_t *out, int64_t value) {
+    uint64_t zz = ((uint64_t)value << 1) ^ (uint64_t)(value >> 63);
+    size_t n = 0;
+    while (zz >= 0x80) {
+        out[n++] = (uint8_t)zz | 0x80;
+        zz >>= 7;
+    }
+    out[n++] = (uint8_t)zz;
+    return n;
+}
+
+static int get_varint(const uint8_t *in, size_t len, int64_t *value) {
+    uint64_t zz = 0;
+    for (size_t n = 0; n < len && n < 10; n++) {
+        zz |= (uint64_t)(in[n] & 0x7F) << (7 * n);
+        if (!(in[n] & 0x80)) {
+            *value = (int64_t)(zz >> 1) ^ -(int64_t)(zz & 1);
+            return n + 1;
+        }
+    }
+    return -1;
+}
+
+// Little-endian IEEE 754, the same bits on the ESP32 and the host
+static size_t put_double(uint8_t *out, double value) {
+    uint64_t bits;
+    memcpy(&bits, &value, sizeof(bits));
+    for (size_t i = 0; i < sizeof(bits); i++) {
+        out[i] = (uint8_t)(bits >> (8 * i));
+    }
+    return sizeof(bits);
+}
+
+static size_t get_double(const uint8_t *in, double *value) {
+    uint64_t bits = 0;
+    for (size_t i = 0; i < sizeof(bits); i++) {
+        bits |= (uint64_t)in[i] << (8 * i);
+    }
+    memcpy(value, &bits, sizeof(bits));
+    return sizeof(bits);
+}
+
+size_t rec_encode(const rec_event_t *ev, int64_t *last_us, uint8_t *out) {
+    uint8_t type = ev->type;
+    uint8_t arg = 0;
+
+    switch (ev->type) {
+        case REC_TICK: arg = ev->tick.levels & 0x3F; break;
+        case REC_EDGE: arg = ev->edge.pin & 0x3F; break;
+        case REC_RFID: arg = ev->rfid.uid_len > REC_UID_MAX_LEN ? REC_UID_MAX_LEN : ev->rfid.uid_len; break;
+        case REC_AUTH: type = REC_RFID; arg = REC_RFID_ARG_AUTH; break;
+        case REC_PROFILE: type = REC_RFID; arg = REC_RFID_ARG_PROFILE; break;
+        default: arg = ev->gap.lost > REC_GAP_MAX ? REC_GAP_MAX : ev->gap.lost; break;
+    }
+
+    size_t n = 0;
+    out[n++] = (uint8_t)(type << 6) | arg;
+    n += put_varint(&out[n], ev->time_us - *last_us);
+    *last_us = ev->time_us;
+
+    if (ev->type == REC_TICK) {
+        uint16_t pot = ev->tick.pot_raw > 0xFFF ? 0xFFF : ev->tick.pot_raw;
+        uint16_t accel = ev->tick.accel_raw > 0xFFF ? 0xFFF : ev->tick.accel_raw;
+        out[n++] = (uint8_t)pot;
+        out[n++] = (uint8_t)((pot >> 8) | (accel << 4));
+        out[n++] = (uint8_t)(accel >> 4);
+    } else if (ev->type == REC_RFID) {
+        memcpy(&out[n], ev->rfid.uid, arg);
+        n += arg;
+    } else if (ev->type == REC_AUTH) {
+        out[n++] = ev->auth.result;
+    } else if (ev->type == REC_PROFILE) {
+        const rec_profile_t *p = &ev->profile;
+        out[n++] = p->assist_min;
+        out[n++] = p->assist_max;
+        out[n++] = p->speed_limit_kmh;
+        out[n++] = p->throttle;
+        n += put_double(&out[n], p->kp);
+        n += put_double(&out[n], p->ki);
+        n += put_double(&out[n], p->kd);
+    }
+    return n;
+}
+
+int rec_decode(const uint8_t *in, size_t len, int64_t *last_us, rec_event_t *ev) {
+    if (len == 0 || in[0] == REC_END_BYTE) return 0;
+
+    uint8_t type = in[0] >> 6;
+    uint8_t arg = in[0] & 0x3F;
+    int64_t delta;
+    int n = get_varint(&in[1], len - 1, &delta);
+    if (n < 0) return -1;
+    n += 1;
+
+    memset(ev, 0, sizeof(*ev));
+    ev->type = type;
+    ev->time_us = *last_us + delta;
+
+    switch (type) {
+        case REC_TICK:
+            if ((size_t)n + 3 > len) return -1;
+            ev->tick.levels = arg;
+            ev->tick.pot_raw = in[n] | ((in[n + 1] & 0x0F) << 8);
+            ev->tick.accel_raw = (in[n + 1] >> 4) | (in[n + 2] << 4);
+            n += 3;
+            break;
+        case REC_EDGE:
+            ev->edge.pin = arg;
+            break;
+        case REC_RFID:
+            if (arg == REC_RFID_ARG_AUTH) {
+                if ((size_t)n + 1 > len) return -1;
+                ev->type = REC_AUTH;
+                ev->auth.result = in[n++];
+                break;
+            }
+            if (arg == REC_RFID_ARG_PROFILE) {
+                if ((size_t)n + REC_PROFILE_LEN > len) return -1;
+                rec_profile_t *p = &ev->profile;
+                ev->type = REC_PROFILE;
+                p->assist_min = in[n++];
+                p->assist_max = in[n++];
+                p->speed_limit_kmh = in[n++];
+                p->throttle = in[n++] != 0;
+                n += get_double(&in[n], &p->kp);
+                n += get_double(&in[n], &p->ki);
+                n += get_double(&in[n], &p->kd);
+                break;
+            }
+            if (arg > REC_UID_MAX_LEN || (size_t)n + arg > len) return -1;
+            ev->rfid.uid_len = arg;
+            memcpy(ev->rfid.uid, &in[n], arg);
+            n += arg;
+            break;
+        default:
+            ev->gap.lost = arg;
+            break;
+    }
+
+    *last_us = ev->time_us;
+    return n;
+}
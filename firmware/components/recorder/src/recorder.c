@@ -0,0 +1,367 @@
+#include "recorder.h"
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "freertos/semphr.h"
+#include "esp_attr.h"
+#include "dlog.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_console.h"
+#endif
+#if CONFIG_EBIKE_REC_ENABLE
+#include "esp_partition.h"
+#endif
+
+#if CONFIG_EBIKE_REC_ENABLE
+
+#define REC_RING_SIZE        CONFIG_EBIKE_REC_RING_SIZE
+#define REC_RING_MASK        (REC_RING_SIZE - 1)
+#define REC_DRAIN_PERIOD_MS  100
+#define REC_PARTITION_LABEL  "ride_rec"
+#define REC_SECTOR_SIZE      4096
+#define REC_HEX_LINE_BYTES   32
+
+// "@R <hex>" lines, read back by tools/rec_extract.py
+typedef struct {
+    char text[4 + 2 * REC_HEX_LINE_BYTES + 2];
+    size_t bytes;
+} rec_hex_line_t;
+
+static void rec_hex_flush(rec_hex_line_t *line) {
+    if (line->bytes) {
+        printf("@R %s\n", line->text);
+        line->bytes = 0;
+    }
+}
+
+static void rec_hex_put(rec_hex_line_t *line, const uint8_t *data, size_t len) {
+    static const char hex[] = "0123456789abcdef";
+    for (size_t i = 0; i < len; i++) {
+        line->text[2 * line->bytes] = hex[data[i] >> 4];
+        line->text[2 * line->bytes + 1] = hex[data[i] & 0x0F];
+        line->text[2 * ++line->bytes] = '\0';
+        if (line->bytes == REC_HEX_LINE_BYTES) {
+            rec_hex_flush(line);
+        }
+    }
+}
+
+_Static_assert((REC_RING_SIZE & REC_RING_MASK) == 0, "CONFIG_EBIKE_REC_RING_SIZE must be a power of two");
+
+static portMUX_TYPE rec_lock = portMUX_INITIALIZER_UNLOCKED;
+volatile bool rec_running = false;
+
+// Ring between the recording call sites (any core, ISRs included) and the
+// drain task. Positions only grow; both are guarded by rec_lock.
+static uint8_t rec_ring[REC_RING_SIZE];
+static uint32_t rec_head;
+static uint32_t rec_tail;
+static int64_t rec_last_us; 					// Time of the last record in the stream
+static uint32_t rec_lost_pending; 				// Lost since the last GAP record
+static uint32_t rec_lost_total;
+static uint32_t rec_bytes_out;
+
+static TaskHandle_t rec_task_handle;
+static SemaphoreHandle_t rec_consumer_lock;
+static const esp_partition_t *rec_partition;
+static uint32_t rec_flash_offset;
+static uint32_t rec_flash_erased; 				// End of the erased area
+
+static inline IRAM_ATTR void rec_ring_copy_in(const uint8_t *data, size_t len) {
+    for (size_t i = 0; i < len; i++) {
+        rec_ring[(rec_head + i) & REC_RING_MASK] = data[i];
+    }
+    rec_head += len;
+}
+
+// Append an encoded record, first noting any loss. rec_lock held.
+static IRAM_ATTR void rec_put(const rec_event_t *ev) {
+    uint8_t buf[2 * REC_MAX_RECORD_LEN];
+    int64_t last_us = rec_last_us;
+    size_t len = 0;
+
+    if (rec_lost_pending) {
+        rec_event_t gap = {
+            .type = REC_GAP,
+            .time_us = ev->time_us,
+            .gap.lost = rec_lost_pending > REC_GAP_MAX ? REC_GAP_MAX : rec_lost_pending,
+        };
+        len = rec_encode(&gap, &last_us, buf);
+    }
+    len += rec_encode(ev, &last_us, &buf[len]);
+
+    if (REC_RING_SIZE - (rec_head - rec_tail) < len) {
+        rec_lost_pending++;
+        rec_lost_total++;
+        return;
+    }
+    rec_ring_copy_in(buf, len);
+    rec_last_us = last_us;
+    rec_lost_pending = 0;
+}
+
+void IRAM_ATTR rec_edge(uint8_t pin, int64_t now_us) {
+    rec_event_t ev = {
+        .type = REC_EDGE,
+        .time_us = now_us,
+        .edge.pin = pin,
+    };
+    portENTER_CRITICAL_SAFE(&rec_lock);
+    rec_put(&ev);
+    portEXIT_CRITICAL_SAFE(&rec_lock);
+}
+
+void IRAM_ATTR rec_tick(int64_t now_us, uint16_t pot_raw, uint16_t accel_raw, uint8_t levels) {
+    rec_event_t ev = {
+        .type = REC_TICK,
+        .time_us = now_us,
+        .tick = { .pot_raw = pot_raw, .accel_raw = accel_raw, .levels = levels },
+    };
+    portENTER_CRITICAL_SAFE(&rec_lock);
+    rec_put(&ev);
+    portEXIT_CRITICAL_SAFE(&rec_lock);
+}
+
+void rec_rfid(const uint8_t *uid, size_t uid_len, int64_t now_us) {
+    rec_event_t ev = {
+        .type = REC_RFID,
+        .time_us = now_us,
+        .rfid.uid_len = uid_len > REC_UID_MAX_LEN ? REC_UID_MAX_LEN : uid_len,
+    };
+    memcpy(ev.rfid.uid, uid, ev.rfid.uid_len);
+
+    portENTER_CRITICAL_SAFE(&rec_lock);
+    rec_put(&ev);
+    portEXIT_CRITICAL_SAFE(&rec_lock);
+}
+
+void rec_auth(uint8_t result, int64_t now_us) {
+    rec_event_t ev = {
+        .type = REC_AUTH,
+        .time_us = now_us,
+        .auth.result = result,
+    };
+
+    portENTER_CRITICAL_SAFE(&rec_lock);
+    rec_put(&ev);
+    portEXIT_CRITICAL_SAFE(&rec_lock);
+}
+
+void rec_profile(const rec_profile_t *profile, int64_t now_us) {
+    rec_event_t ev = {
+        .type = REC_PROFILE,
+        .time_us = now_us,
+        .profile = *profile,
+    };
+
+    portENTER_CRITICAL_SAFE(&rec_lock);
+    rec_put(&ev);
+    portEXIT_CRITICAL_SAFE(&rec_lock);
+}
+
+// Keep the sector after the last byte erased, so the stream always ends on 0xFF
+static bool rec_flash_write(const uint8_t *data, size_t len) {
+    if (rec_flash_offset + len >= rec_partition->size) {
+        return false;
+    }
+    while (rec_flash_erased <= rec_flash_offset + len) {
+        if (rec_flash_erased >= rec_partition->size) break;
+        esp_partition_erase_range(rec_partition, rec_flash_erased, REC_SECTOR_SIZE);
+        rec_flash_erased += REC_SECTOR_SIZE;
+    }
+    esp_partition_write(rec_partition, rec_flash_offset, data, len);
+    rec_flash_offset += len;
+    return true;
+}
+
+// Single consumer: the drain task, or a console command holding rec_consumer_lock
+static void rec_drain(void) {
+    static rec_hex_line_t line;
+    uint8_t chunk[256];
+
+    xSemaphoreTake(rec_consumer_lock, portMAX_DELAY);
+    for (;;) {
+        size_t len = 0;
+        portENTER_CRITICAL(&rec_lock);
+        while (rec_tail != rec_head && len < sizeof(chunk)) {
+            chunk[len++] = rec_ring[rec_tail++ & REC_RING_MASK];
+        }
+        portEXIT_CRITICAL(&rec_lock);
+        if (len == 0) break;
+
+        if (rec_partition) {
+            if (!rec_flash_write(chunk, len)) {
+                DLOGW(REC_FLASH_FULL);
+                rec_running = false;
+                break;
+            }
+        } else {
+            rec_hex_put(&line, chunk, len);
+        }
+        rec_bytes_out += len;
+    }
+    rec_hex_flush(&line);
+    xSemaphoreGive(rec_consumer_lock);
+}
+
+static void rec_task(void *arg) {
+    while (1) {
+        rec_drain();
+        vTaskDelay(pdMS_TO_TICKS(REC_DRAIN_PERIOD_MS));
+    }
+}
+
+esp_err_t rec_start(void) {
+    if (!rec_consumer_lock) return ESP_ERR_INVALID_STATE;
+
+    rec_running = false;
+    rec_drain();
+
+    rec_partition = NULL;
+#if CONFIG_EBIKE_REC_SINK_FLASH
+    rec_partition = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, REC_PARTITION_LABEL);
+    if (!rec_partition) {
+        DLOGW(REC_NO_PARTITION);
+    }
+    rec_flash_offset = 0;
+    rec_flash_erased = 0;
+#endif
+
+    portENTER_CRITICAL(&rec_lock);
+    rec_head = rec_tail = 0;
+    rec_last_us = 0;
+    rec_lost_pending = 0;
+    rec_lost_total = 0;
+    rec_ring_copy_in((const uint8_t *)REC_MAGIC, REC_MAGIC_LEN);
+    portEXIT_CRITICAL(&rec_lock);
+
+    rec_bytes_out = 0;
+    rec_running = true;
+    DLOGI(REC_STARTED);
+    return ESP_OK;
+}
+
+void rec_stop(void) {
+    if (!rec_consumer_lock) return;
+
+    rec_running = false;
+    rec_drain();
+    if (!rec_partition) {
+        printf("@R end\n");
+    }
+    DLOGI(REC_STOPPED, rec_bytes_out, rec_lost_total);
+}
+
+void rec_dump(void) {
+    const esp_partition_t *part = esp_partition_find_first(ESP_PARTITION_TYPE_DATA, ESP_PARTITION_SUBTYPE_ANY, REC_PARTITION_LABEL);
+    uint8_t buf[REC_MAX_RECORD_LEN];
+    rec_hex_line_t line = { 0 };
+    rec_event_t ev;
+    int64_t last_us = 0;
+
+    if (!part) {
+        printf("rec: no %s partition\n", REC_PARTITION_LABEL);
+        return;
+    }
+    esp_partition_read(part, 0, buf, REC_MAGIC_LEN);
+    if (memcmp(buf, REC_MAGIC, REC_MAGIC_LEN) != 0) {
+        printf("rec: no recording\n");
+        return;
+    }
+
+    // Walk the records to find where the stream ends
+    printf("@R begin\n");
+    rec_hex_put(&line, buf, REC_MAGIC_LEN);
+    for (uint32_t pos = REC_MAGIC_LEN; pos < part->size; ) {
+        size_t avail = part->size - pos < sizeof(buf) ? part->size - pos : sizeof(buf);
+        esp_partition_read(part, pos, buf, avail);
+        int n = rec_decode(buf, avail, &last_us, &ev);
+        if (n <= 0) break;
+        rec_hex_put(&line, buf, n);
+        pos += n;
+    }
+    rec_hex_flush(&line);
+    printf("@R end\n");
+}
+
+esp_err_t rec_init(void) {
+    if (rec_task_handle) return ESP_ERR_INVALID_STATE;
+
+    rec_consumer_lock = xSemaphoreCreateMutex();
+    if (!rec_consumer_lock) return ESP_ERR_NO_MEM;
+
+    if (xTaskCreate(rec_task, "rec", 3072, NULL, 2, &rec_task_handle) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+#if CONFIG_EBIKE_REC_AUTOSTART
+    return rec_start();
+#else
+    return ESP_OK;
+#endif
+}
+
+static void rec_status(void) {
+    printf("rec: %s, sink %s, %lu bytes out, %lu records lost\n",
+           rec_running ? "recording" : "stopped",
+           rec_partition ? REC_PARTITION_LABEL : "uart",
+           (unsigned long)rec_bytes_out, (unsigned long)rec_lost_total);
+}
+
+#else
+
+esp_err_t rec_init(void) {
+    return ESP_OK;
+}
+
+esp_err_t rec_start(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+void rec_stop(void) {}
+
+void rec_dump(void) {
+    printf("rec: disabled (CONFIG_EBIKE_REC_ENABLE=n)\n");
+}
+
+#if !CONFIG_IDF_TARGET_LINUX
+static void rec_status(void) {
+    rec_dump();
+}
+#endif
+
+#endif 				// CONFIG_EBIKE_REC_ENABLE
+
+#if !CONFIG_IDF_TARGET_LINUX
+static int rec_cmd(int argc, char **argv) {
+    const char *action = argc > 1 ? argv[1] : "status";
+
+    if (strcmp(action, "start") == 0) {
+        rec_start();
+    } else if (strcmp(action, "stop") == 0) {
+        rec_stop();
+    } else if (strcmp(action, "dump") == 0) {
+        rec_dump();
+    } else if (strcmp(action, "status") == 0) {
+        rec_status();
+    } else {
+        printf("usage: rec [status|start|stop|dump]\n");
+        return 1;
+    }
+    return 0;
+}
+
+esp_err_t rec_register_console_cmd(void) {
+    const esp_console_cmd_t cmd = {
+        .command = "rec",
+        .help = "Ride recorder: status (default), start, stop, dump (flash sink)",
+        .hint = "[status|start|stop|dump]",
+        .func = rec_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
+#else
+esp_err_t rec_register_console_cmd(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif
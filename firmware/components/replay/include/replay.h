@@ -0,0 +1,42 @@
+#ifndef REPLAY_H
+#define REPLAY_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include "esp_err.h"
+#include "rec_format.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Host replay of a ride recording (linux target only).
+// Feeds the recorded inputs through the HAL mock into the control, turn
+// signal, display and RFID code on a virtual clock, so a run is
+// bit-exact and only limited by host CPU time.
+
+typedef struct {
+    uint32_t ticks;
+    uint32_t edges;
+    uint32_t tags;
+    uint32_t lost; 					// Records the recorder dropped (GAP)
+    uint32_t frames; 					// display_update() calls
+    int64_t start_us; 					// Recorded time span
+    int64_t end_us;
+    uint32_t digest; 					// FNV-1a of every output, for comparing runs
+} replay_result_t;
+
+// Called after each replayed control tick with the DAC value it produced
+typedef void (*replay_tick_cb_t)(const rec_event_t *tick, uint8_t dac_value, void *ctx);
+
+// Replay a whole stream (magic included). on_tick may be NULL.
+// Returns ESP_ERR_INVALID_ARG without the magic and ESP_ERR_INVALID_SIZE
+// for a truncated stream (result then covers the records before it).
+esp_err_t replay_run(const uint8_t *stream, size_t len, replay_tick_cb_t on_tick, void *ctx,
+                     replay_result_t *result);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// REPLAY_H
@@ -0,0 +1,180 @@
+#include "replay.h"
+#include <string.h>
+#include "ebike_hal.h"
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "motor_control.h"
+#include "turn_signals.h"
+#include "display.h"
+#include "rfid.h"
+#include "rfid_mock.h"
+#include "supervisor.h"
+#include "auth.h"
+
+#define FNV_OFFSET           2166136261u
+#define FNV_PRIME            16777619u
+
+typedef struct {
+    replay_result_t *result;
+    bool activated;
+    int64_t next_frame_us; 				// Display loop wake-up, as in app_main()
+} replay_state_t;
+
+static void digest_bytes(uint32_t *digest, const void *data, size_t len) {
+    const uint8_t *p = data;
+    for (size_t i = 0; i < len; i++) {
+        *digest = (*digest ^ p[i]) * FNV_PRIME;
+    }
+}
+
+// Everything the display puts on the bus is part of the output
+static void replay_spi_hook(hal_spi_dev_t dev, const uint8_t *data, size_t len, void *ctx) {
+    replay_result_t *result = ctx;
+    uint8_t dc = hal_mock_dio_get(DISPLAY_DC_PIN);
+    digest_bytes(&result->digest, &dc, 1);
+    digest_bytes(&result->digest, data, len);
+}
+
+// The allowlist and the tag's profile are not replayed: on_rfid_tag() in
+// main.c records the decision and the profile it applied, and
+// replay_auth()/replay_profile() act on those
+static void replay_on_tag(const uint8_t *uid, size_t uid_len, void *ctx) {
+    replay_state_t *state = ctx;
+    state->result->tags++;
+}
+
+static void replay_auth(replay_state_t *state, const rec_event_t *ev) {
+    if (ev->auth.result == AUTH_GRANTED && !state->activated) {
+        state->activated = true;
+        hal_dio_write(SYSTEM_ACTIVE_LED, 1);
+        // on_rfid_tag() wakes the display loop for the riding screen
+        state->next_frame_us = ev->time_us;
+    }
+}
+
+static void replay_profile(const rec_event_t *ev) {
+    const motor_profile_t profile = {
+        .assist_min = ev->profile.assist_min,
+        .assist_max = ev->profile.assist_max,
+        .speed_limit_kmh = ev->profile.speed_limit_kmh,
+        .throttle = ev->profile.throttle,
+        .kp = ev->profile.kp,
+        .ki = ev->profile.ki,
+        .kd = ev->profile.kd,
+    };
+    motor_control_set_profile(&profile);
+}
+
+static void replay_tick(const rec_event_t *ev) {
+    hal_mock_ain_set(POTENTIOMETER_ADC, ev->tick.pot_raw);
+    hal_mock_ain_set(ACCELERATOR_ADC, ev->tick.accel_raw);
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, ev->tick.levels & TURN_LEVEL_RIGHT);
+    hal_mock_dio_set(TURN_SIGNAL_LEFT, ev->tick.levels & TURN_LEVEL_LEFT);
+    hal_mock_dio_set(RCWL_RIGHT_GPIO, ev->tick.levels & RCWL_LEVEL_RIGHT);
+    hal_mock_dio_set(RCWL_LEFT_GPIO, ev->tick.levels & RCWL_LEVEL_LEFT);
+    motor_control_tick();
+}
+
+esp_err_t replay_run(const uint8_t *stream, size_t len, replay_tick_cb_t on_tick, void *ctx,
+                     replay_result_t *result) {
+    if (!stream || !result || len < REC_MAGIC_LEN || memcmp(stream, REC_MAGIC, REC_MAGIC_LEN) != 0) {
+        return ESP_ERR_INVALID_ARG;
+    }
+
+    memset(result, 0, sizeof(*result));
+    result->digest = FNV_OFFSET;
+    replay_state_t state = { .result = result };
+
+    // Fresh board, same bring-up order as app_main()
+    hal_mock_reset();
+    hal_mock_time_manual(true);
+    supervisor_init();
+    motor_control_reset();
+    turn_signals_reset();
+    hal_dio_config(1ULL << SYSTEM_ACTIVE_LED, HAL_PIN_OUTPUT, HAL_EDGE_NONE);
+    turn_signals_init();
+    motor_control_init();
+    display_init();
+    rfid_init(replay_on_tag, &state);
+    display_show_waiting();
+    hal_mock_spi_set_hook(replay_spi_hook, result);
+
+    esp_err_t ret = ESP_OK;
+    int64_t last_us = 0;
+    bool first = true;
+    size_t pos = REC_MAGIC_LEN;
+
+    while (pos < len) {
+        rec_event_t ev;
+        int n = rec_decode(&stream[pos], len - pos, &last_us, &ev);
+        if (n == 0) break;
+        if (n < 0) {
+            ret = ESP_ERR_INVALID_SIZE;
+            break;
+        }
+        pos += n;
+
+        if (first) {
+            result->start_us = ev.time_us;
+            state.next_frame_us = ev.time_us;
+            first = false;
+        }
+        result->end_us = ev.time_us;
+        hal_mock_time_set_us(ev.time_us);
+
+        switch (ev.type) {
+            case REC_TICK: {
+                replay_tick(&ev);
+                result->ticks++;
+
+                uint8_t out[4] = {
+                    hal_mock_aout_get(DAC_OUTPUT_CHANNEL),
+                    hal_mock_dio_get(BLIND_SPOT_LED_GPIO),
+                    hal_mock_dio_get(SYSTEM_ACTIVE_LED),
+                    turn_signals_state(),
+                };
+                float speed = motor_control_speed_kmh();
+                digest_bytes(&result->digest, out, sizeof(out));
+                digest_bytes(&result->digest, &speed, sizeof(speed));
+                if (on_tick) on_tick(&ev, out[0], ctx);
+
+                if (ev.time_us >= state.next_frame_us) {
+                    if (state.activated) {
+                        display_status_t status = {
+                            .speed_kmh = motor_control_speed_kmh(),
+                            .assist_level = motor_control_assist_level(),
+                            .turn = turn_signals_state(),
+                        };
+                        display_update(&status);
+                        result->frames++;
+                    } else {
+                        display_idle();
+                    }
+                    state.next_frame_us = ev.time_us + (int64_t)display_refresh_ms() * 1000;
+                }
+                break;
+            }
+            case REC_EDGE:
+                // Hall and pedal inputs idle high and trigger on the rising edge
+                hal_mock_dio_set(ev.edge.pin, 0);
+                hal_mock_dio_set(ev.edge.pin, 1);
+                result->edges++;
+                break;
+            case REC_RFID:
+                rfid_mock_present(ev.rfid.uid, ev.rfid.uid_len);
+                break;
+            case REC_AUTH:
+                replay_auth(&state, &ev);
+                break;
+            case REC_PROFILE:
+                replay_profile(&ev);
+                break;
+            default:
+                result->lost += ev.gap.lost;
+                break;
+        }
+    }
+
+    hal_mock_spi_set_hook(NULL, NULL);
+    return ret;
+}
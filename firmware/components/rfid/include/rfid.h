@@ -0,0 +1,37 @@
+#ifndef RFID_H
+#define RFID_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+#define RFID_UID_MAX_LEN     10
+
+// Called from the scanner task when a tag enters the field
+typedef void (*rfid_tag_cb_t)(const uint8_t *uid, size_t uid_len, void *ctx);
+
+// Bring up the RC522 and start scanning. on_tag runs once per tag presented.
+esp_err_t rfid_init(rfid_tag_cb_t on_tag, void *ctx);
+
+// Read NTAG21x pages [start, end] of the tag being handled, in one
+// FAST_READ. Only valid from the tag callback. ESP_ERR_NOT_SUPPORTED for
+// tags without FAST_READ (MIFARE Classic, Ultralight).
+esp_err_t rfid_read_pages(uint8_t start, uint8_t end, uint8_t *buffer, size_t len);
+
+// When the tag being handled answered the REQA (hal_time_us())
+int64_t rfid_tap_time_us(void);
+
+// Scan while waiting for a tag; otherwise stop, with the antenna off.
+// Scanning is on after rfid_init().
+void rfid_set_waiting(bool waiting);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// RFID_H
@@ -0,0 +1,25 @@
+#ifndef RFID_MOCK_H
+#define RFID_MOCK_H
+
+#include "rfid.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Simulate a tag entering the field (linux target only), ignored while
+// rfid_set_waiting(false)
+void rfid_mock_present(const uint8_t *uid, size_t uid_len);
+
+// Memory of the tags presented from now on, from page 0, for
+// rfid_read_pages(). NULL: tags without FAST_READ. Not copied.
+void rfid_mock_set_pages(const uint8_t *pages, size_t len);
+
+// rfid_read_pages() calls since rfid_init()
+unsigned rfid_mock_page_reads(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// RFID_MOCK_H
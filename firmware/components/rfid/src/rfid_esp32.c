@@ -0,0 +1,135 @@
+#include "rfid.h"
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "rc522.h"
+#include "driver/rc522_spi.h"
+#include "rc522_picc.h"
+#include "picc/rc522_nxp.h"
+#include "board_pins.h"
+#include "trace.h"
+#include "recorder.h"
+#include "ebike_hal.h"
+#include "hal_spi_prof.h"
+
+static rc522_handle_t scanner;
+static rc522_driver_handle_t driver;
+static hal_spi_client_t bus_client;
+static hal_spi_prof_t *spi_prof;
+static rfid_tag_cb_t tag_cb;
+static void *tag_cb_ctx;
+static bool waiting = true;
+static const rc522_picc_t *current_picc; 			// Only during the tag callback
+static int64_t tap_us;
+
+// RC522 SPI transaction hooks (run for every transaction on the RFID device)
+static void IRAM_ATTR rc522_spi_pre_cb(spi_transaction_t *t) {
+    TRACE_BEGIN(TRACE_EV_RC522_XFER, t->length);
+    HAL_SPI_PROF_BEGIN(spi_prof);
+}
+
+// The driver polls every transfer. Frames are full-duplex, the address
+// byte (register and read bit) is in user.
+static void IRAM_ATTR rc522_spi_post_cb(spi_transaction_t *t) {
+    TRACE_END(TRACE_EV_RC522_XFER, (uint32_t)(uintptr_t)t->user);
+    HAL_SPI_PROF_END(spi_prof, t->length / 8, true);
+}
+
+// The RC522 shares its host with the display (board_pins.h)
+static esp_err_t rc522_bus_acquire(void *ctx) {
+    return hal_spi_acquire(bus_client);
+}
+
+static void rc522_bus_release(void *ctx) {
+    hal_spi_release(bus_client);
+}
+
+// Direct callback: no event loop between the select and the tag callback
+static void on_picc_state_changed(const rc522_picc_t *picc, rc522_picc_state_t old_state, void *ctx) {
+    if (picc->state == RC522_PICC_STATE_READY) {
+        tap_us = hal_time_us();
+    } else if (picc->state == RC522_PICC_STATE_ACTIVE && tag_cb) {
+        REC_RFID(picc->uid.value, picc->uid.length, hal_time_us());
+        current_picc = picc;
+        tag_cb(picc->uid.value, picc->uid.length, tag_cb_ctx);
+        current_picc = NULL;
+    }
+}
+
+esp_err_t rfid_read_pages(uint8_t start, uint8_t end, uint8_t *buffer, size_t len) {
+    if (!current_picc) return ESP_ERR_INVALID_STATE;
+    if (!rc522_nxp_type_has_fast_read(current_picc->type)) return ESP_ERR_NOT_SUPPORTED;
+    if (start > end || len < (size_t)(end - start + 1) * RC522_NXP_PAGE_SIZE) return ESP_ERR_INVALID_ARG;
+
+    rc522_nxp_fast_read_data_t data = {
+        .bytes = buffer,
+        .buffer_size = len > UINT8_MAX ? UINT8_MAX : len,
+    };
+    return rc522_nxp_fast_read(scanner, current_picc, start, end, &data);
+}
+
+int64_t rfid_tap_time_us(void) {
+    return tap_us;
+}
+
+esp_err_t rfid_init(rfid_tag_cb_t on_tag, void *ctx) {
+    tag_cb = on_tag;
+    tag_cb_ctx = ctx;
+
+    // The bus is set up by the application, with MISO; this only takes a
+    // reference and checks the pins
+    hal_spi_bus_config_t bus_config = {
+        .host = RC522_SPI_HOST,
+        .pin_mosi = RC522_MOSI_GPIO,
+        .pin_miso = RC522_MISO_GPIO,
+        .pin_sclk = RC522_SCLK_GPIO,
+    };
+    esp_err_t ret = hal_spi_bus_init(&bus_config);
+    if (ret != ESP_OK) return ret;
+
+    hal_spi_client_config_t client_config = {
+        .host = RC522_SPI_HOST,
+        .name = "rc522",
+        .priority = RC522_SPI_PRIORITY,
+    };
+    ret = hal_spi_add_client(&client_config, &bus_client);
+    if (ret != ESP_OK) return ret;
+    spi_prof = HAL_SPI_PROF_REGISTER("rc522");
+
+    rc522_spi_config_t driver_config = {
+        .host_id = RC522_SPI_HOST,
+        .bus_config = NULL, 						// Initialized above
+        .dev_config = {
+            .spics_io_num = RC522_SDA_GPIO,
+            .pre_cb = rc522_spi_pre_cb,
+            .post_cb = rc522_spi_post_cb,
+        },
+        .rst_io_num = RC522_RST_GPIO,
+        .bus_acquire = rc522_bus_acquire,
+        .bus_release = rc522_bus_release,
+    };
+    ret = rc522_spi_create(&driver_config, &driver);
+    if (ret != ESP_OK) return ret;
+    ret = rc522_driver_install(driver);
+    if (ret != ESP_OK) return ret;
+
+    rc522_config_t scanner_config = {
+        .driver = driver,
+        .irq_io_num = RC522_IRQ_GPIO,
+        .detect_interval_ms = CONFIG_RFID_DETECT_LATENCY_MS,
+    };
+    ret = rc522_create(&scanner_config, &scanner);
+    if (ret != ESP_OK) return ret;
+    rc522_set_picc_state_callback(scanner, on_picc_state_changed, NULL);
+    return rc522_start(scanner);
+}
+
+// Runs in the scanner task from the tag callback, or in the caller's
+void rfid_set_waiting(bool on) {
+    if (!scanner || on == waiting) return;
+    waiting = on;
+    if (on) {
+        rc522_start(scanner);
+    } else {
+        rc522_pause(scanner);
+    }
+}
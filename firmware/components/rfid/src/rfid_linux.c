@@ -0,0 +1,56 @@
+#include <string.h>
+#include "rfid.h"
+#include "rfid_mock.h"
+#include "ebike_hal.h"
+
+static rfid_tag_cb_t tag_cb;
+static void *tag_cb_ctx;
+static bool waiting = true;
+static const uint8_t *pages;
+static size_t pages_len;
+static unsigned page_reads;
+static int64_t tap_us;
+
+esp_err_t rfid_init(rfid_tag_cb_t on_tag, void *ctx) {
+    tag_cb = on_tag;
+    tag_cb_ctx = ctx;
+    waiting = true;
+    page_reads = 0;
+    return ESP_OK;
+}
+
+esp_err_t rfid_read_pages(uint8_t start, uint8_t end, uint8_t *buffer, size_t len) {
+    size_t offset = (size_t)start * 4;
+    size_t count = (size_t)(end - start + 1) * 4;
+
+    if (start > end || len < count) return ESP_ERR_INVALID_ARG;
+    if (!pages) return ESP_ERR_NOT_SUPPORTED;
+    page_reads++;
+    if (offset + count > pages_len) return ESP_FAIL; 		// NAK past the end
+    memcpy(buffer, &pages[offset], count);
+    return ESP_OK;
+}
+
+int64_t rfid_tap_time_us(void) {
+    return tap_us;
+}
+
+void rfid_set_waiting(bool on) {
+    waiting = on;
+}
+
+void rfid_mock_present(const uint8_t *uid, size_t uid_len) {
+    if (tag_cb && waiting && uid_len <= RFID_UID_MAX_LEN) {
+        tap_us = hal_time_us();
+        tag_cb(uid, uid_len, tag_cb_ctx);
+    }
+}
+
+void rfid_mock_set_pages(const uint8_t *data, size_t len) {
+    pages = data;
+    pages_len = len;
+}
+
+unsigned rfid_mock_page_reads(void) {
+    return page_reads;
+}
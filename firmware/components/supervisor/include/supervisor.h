@@ -0,0 +1,59 @@
+#ifndef SUPERVISOR_H
+#define SUPERVISOR_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "esp_err.h"
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Control-loop supervisor.
+// The control task feeds a heartbeat every tick. A hardware timer checks
+// it every CONFIG_EBIKE_SUPERVISOR_CHECK_US and, once it is older than
+// CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS, writes 0 to the motor DAC from the
+// timer ISR and latches the fault: set_motor_output() then keeps the
+// motor off until supervisor_clear(). The control task is also
+// subscribed to the Task WDT as the last line of defence.
+
+// Persistent fault record (RTC memory, saved to NVS by a task)
+typedef struct {
+    uint32_t trips; 					// Deadline misses since the record was cleared
+    uint32_t last_stall_us; 				// Last heartbeat to motor cut
+    uint32_t max_stall_us;
+    uint32_t wdt_resets; 				// Boots after a Task WDT reset
+} supervisor_diag_t;
+
+// Start the check timer and load the fault record
+esp_err_t supervisor_init(void);
+
+// Subscribe the calling task to the Task WDT
+esp_err_t supervisor_attach_task(void);
+
+// Heartbeat, once per control tick (also feeds the Task WDT)
+void supervisor_feed(void);
+
+// Deadline check, run from the timer ISR. Returns true when it tripped.
+bool supervisor_poll(int64_t now_us);
+
+// Fault latched: the motor output is held at 0
+bool supervisor_tripped(void);
+
+// Release the latch; the next heartbeat re-arms the deadline
+void supervisor_clear(void);
+
+void supervisor_get_diag(supervisor_diag_t *diag);
+void supervisor_clear_diag(void);
+
+// Fault injection: the next supervisor_feed() busy-waits this long
+void supervisor_inject_stall(uint32_t ms);
+
+// Register the "sup" console command (call after the REPL is created)
+esp_err_t supervisor_register_console_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// SUPERVISOR_H
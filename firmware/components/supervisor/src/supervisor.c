@@ -0,0 +1,261 @@
+#include "supervisor.h"
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include "sdkconfig.h"
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ebike_hal.h"
+#include "board_pins.h"
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_attr.h"
+#include "esp_system.h"
+#include "esp_task_wdt.h"
+#include "esp_console.h"
+#include "driver/gptimer.h"
+#include "nvs.h"
+#include "dlog.h"
+#endif
+
+#define SUPERVISOR_DEADLINE_US   ((uint32_t)CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS * 1000)
+#define SUPERVISOR_DIAG_MAGIC    0x53555056 			// "SUPV"
+
+// 32 bits so the ISR on the other core never sees a torn write
+static volatile uint32_t last_heartbeat_us;
+static volatile bool armed; 					// Set by the first heartbeat
+static volatile bool tripped;
+static volatile uint32_t inject_stall_ms;
+
+// Survives a software or watchdog reset, so a trip right before a crash
+// is not lost. pending is set by the ISR until the task stores it in NVS.
+typedef struct {
+    uint32_t magic;
+    uint32_t pending;
+    supervisor_diag_t diag;
+} supervisor_rtc_t;
+
+#if CONFIG_IDF_TARGET_LINUX
+static supervisor_rtc_t rtc_diag;
+#else
+static RTC_NOINIT_ATTR supervisor_rtc_t rtc_diag;
+static TaskHandle_t diag_task_handle;
+#endif
+
+bool HAL_ISR_ATTR supervisor_poll(int64_t now_us) {
+    // Keep forcing 0 while latched, in case the task was preempted
+    // between its own check and the DAC write
+    if (tripped) {
+        hal_aout_write_from_isr(DAC_OUTPUT_CHANNEL, 0);
+        return false;
+    }
+
+    uint32_t stall_us = (uint32_t)now_us - last_heartbeat_us;
+    if (!armed || stall_us <= SUPERVISOR_DEADLINE_US) {
+        return false;
+    }
+
+    // Cut first, bookkeeping after
+    tripped = true;
+    hal_aout_write_from_isr(DAC_OUTPUT_CHANNEL, 0);
+
+    rtc_diag.diag.trips++;
+    rtc_diag.diag.last_stall_us = stall_us;
+    if (stall_us > rtc_diag.diag.max_stall_us) rtc_diag.diag.max_stall_us = stall_us;
+    rtc_diag.pending = 1;
+    return true;
+}
+
+void supervisor_feed(void) {
+    uint32_t stall = inject_stall_ms;
+    if (stall) {
+        inject_stall_ms = 0;
+        int64_t until = hal_time_us() + (int64_t)stall * 1000;
+        while (hal_time_us() < until) {
+            // Spin like a driver stuck in a polling loop
+        }
+    }
+
+    last_heartbeat_us = (uint32_t)hal_time_us();
+    armed = true;
+#if !CONFIG_IDF_TARGET_LINUX
+    esp_task_wdt_reset();
+#endif
+}
+
+bool supervisor_tripped(void) {
+    return tripped;
+}
+
+void supervisor_clear(void) {
+    armed = false;
+    tripped = false;
+}
+
+void supervisor_inject_stall(uint32_t ms) {
+    inject_stall_ms = ms;
+}
+
+void supervisor_get_diag(supervisor_diag_t *diag) {
+    *diag = rtc_diag.diag;
+}
+
+#if CONFIG_IDF_TARGET_LINUX
+
+esp_err_t supervisor_init(void) {
+    memset(&rtc_diag, 0, sizeof(rtc_diag));
+    rtc_diag.magic = SUPERVISOR_DIAG_MAGIC;
+    supervisor_clear();
+    return ESP_OK;
+}
+
+esp_err_t supervisor_attach_task(void) {
+    return ESP_OK;
+}
+
+void supervisor_clear_diag(void) {
+    memset(&rtc_diag.diag, 0, sizeof(rtc_diag.diag));
+    rtc_diag.pending = 0;
+}
+
+esp_err_t supervisor_register_console_cmd(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+
+#else
+
+#define DIAG_NVS_NAMESPACE   "diag"
+#define DIAG_NVS_KEY         "supervisor"
+
+static gptimer_handle_t check_timer;
+
+static bool IRAM_ATTR check_timer_cb(gptimer_handle_t timer, const gptimer_alarm_event_data_t *edata, void *ctx) {
+    BaseType_t woken = pdFALSE;
+    if (supervisor_poll(hal_time_us()) && diag_task_handle) {
+        vTaskNotifyGiveFromISR(diag_task_handle, &woken);
+    }
+    return woken == pdTRUE;
+}
+
+static void diag_save(void) {
+    nvs_handle_t nvs;
+    if (nvs_open(DIAG_NVS_NAMESPACE, NVS_READWRITE, &nvs) != ESP_OK) return;
+
+    supervisor_diag_t diag = rtc_diag.diag;
+    rtc_diag.pending = 0;
+    if (nvs_set_blob(nvs, DIAG_NVS_KEY, &diag, sizeof(diag)) == ESP_OK) {
+        nvs_commit(nvs);
+    }
+    nvs_close(nvs);
+}
+
+static void diag_load(void) {
+    supervisor_diag_t stored = { 0 };
+    nvs_handle_t nvs;
+    if (nvs_open(DIAG_NVS_NAMESPACE, NVS_READONLY, &nvs) == ESP_OK) {
+        size_t len = sizeof(stored);
+        if (nvs_get_blob(nvs, DIAG_NVS_KEY, &stored, &len) != ESP_OK || len != sizeof(stored)) {
+            memset(&stored, 0, sizeof(stored));
+        }
+        nvs_close(nvs);
+    }
+
+    // A valid RTC record with a trip NVS has not seen yet is newer
+    bool rtc_valid = rtc_diag.magic == SUPERVISOR_DIAG_MAGIC;
+    if (!rtc_valid || !rtc_diag.pending) {
+        rtc_diag.diag = stored;
+    }
+    rtc_diag.magic = SUPERVISOR_DIAG_MAGIC;
+    rtc_diag.pending = rtc_valid && rtc_diag.pending;
+
+    if (esp_reset_reason() == ESP_RST_TASK_WDT) {
+        rtc_diag.diag.wdt_resets++;
+        rtc_diag.pending = 1;
+    }
+}
+
+// Moves fault records from the ISR to NVS and logs them
+static void diag_task(void *arg) {
+    while (1) {
+        if (rtc_diag.pending) {
+            DLOGE(SUPERVISOR_TRIP, rtc_diag.diag.last_stall_us, rtc_diag.diag.trips);
+            diag_save();
+        }
+        ulTaskNotifyTake(pdTRUE, portMAX_DELAY);
+    }
+}
+
+esp_err_t supervisor_init(void) {
+    if (check_timer) return ESP_ERR_INVALID_STATE;
+
+    diag_load();
+    supervisor_clear();
+
+    if (xTaskCreate(diag_task, "supervisor", 3072, NULL, 3, &diag_task_handle) != pdPASS) {
+        return ESP_ERR_NO_MEM;
+    }
+
+    gptimer_config_t timer_config = {
+        .clk_src = GPTIMER_CLK_SRC_DEFAULT,
+        .direction = GPTIMER_COUNT_UP,
+        .resolution_hz = 1000000,
+    };
+    esp_err_t ret = gptimer_new_timer(&timer_config, &check_timer);
+    if (ret != ESP_OK) return ret;
+
+    gptimer_event_callbacks_t cbs = {
+        .on_alarm = check_timer_cb,
+    };
+    gptimer_alarm_config_t alarm_config = {
+        .alarm_count = CONFIG_EBIKE_SUPERVISOR_CHECK_US,
+        .reload_count = 0,
+        .flags.auto_reload_on_alarm = true,
+    };
+    ESP_ERROR_CHECK(gptimer_register_event_callbacks(check_timer, &cbs, NULL));
+    ESP_ERROR_CHECK(gptimer_set_alarm_action(check_timer, &alarm_config));
+    ESP_ERROR_CHECK(gptimer_enable(check_timer));
+    return gptimer_start(check_timer);
+}
+
+esp_err_t supervisor_attach_task(void) {
+    return esp_task_wdt_add(NULL);
+}
+
+void supervisor_clear_diag(void) {
+    memset(&rtc_diag.diag, 0, sizeof(rtc_diag.diag));
+    diag_save();
+}
+
+static int sup_cmd(int argc, char **argv) {
+    const char *action = argc > 1 ? argv[1] : "status";
+
+    if (strcmp(action, "status") == 0) {
+        supervisor_diag_t diag;
+        supervisor_get_diag(&diag);
+        printf("supervisor: %s, deadline %d ms, %lu trips, last stall %lu us, max %lu us, %lu WDT resets\n",
+               tripped ? "TRIPPED" : "ok", CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS,
+               (unsigned long)diag.trips, (unsigned long)diag.last_stall_us,
+               (unsigned long)diag.max_stall_us, (unsigned long)diag.wdt_resets);
+    } else if (strcmp(action, "clear") == 0) {
+        supervisor_clear();
+    } else if (strcmp(action, "reset-diag") == 0) {
+        supervisor_clear_diag();
+    } else if (strcmp(action, "stall") == 0 && argc > 2) {
+        supervisor_inject_stall(strtoul(argv[2], NULL, 0));
+    } else {
+        printf("usage: sup [status|clear|reset-diag|stall <ms>]\n");
+        return 1;
+    }
+    return 0;
+}
+
+esp_err_t supervisor_register_console_cmd(void) {
+    const esp_console_cmd_t cmd = {
+        .command = "sup",
+        .help = "Control supervisor: status (default), clear the motor cut, reset-diag, stall <ms> (fault injection)",
+        .hint = "[status|clear|reset-diag|stall <ms>]",
+        .func = sup_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
+
+#endif 				// CONFIG_IDF_TARGET_LINUX
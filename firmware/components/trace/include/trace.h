@@ -0,0 +1,101 @@
+#ifndef TRACE_H
+#define TRACE_H
+
+#include <stdint.h>
+#include <stdbool.h>
+#include "sdkconfig.h"
+#include "esp_err.h"
+#include "freertos/FreeRTOS.h"
+#if CONFIG_EBIKE_TRACE_ENABLE
+#include "esp_cpu.h"
+#endif
+
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+// Traced events. Keep in sync with the name table in trace.c
+typedef enum {
+    TRACE_EV_NONE = 0,
+    TRACE_EV_HALL_ISR,
+    TRACE_EV_PEDAL_ISR,
+    TRACE_EV_CONTROL_TICK,
+    TRACE_EV_ADC_READ,
+    TRACE_EV_DISPLAY_FLUSH,
+    TRACE_EV_RC522_XFER,
+    TRACE_EV_MAX
+} trace_event_t;
+
+// Record phase, mapped to Chrome trace "B", "E" and "i"
+typedef enum {
+    TRACE_PHASE_BEGIN = 0,
+    TRACE_PHASE_END,
+    TRACE_PHASE_INSTANT,
+} trace_phase_t;
+
+// One ring entry (8 bytes)
+typedef struct {
+    uint32_t cycles; 					// CCOUNT of the core that wrote it
+    uint8_t event; 					// trace_event_t
+    uint8_t phase; 					// trace_phase_t
+    uint16_t arg; 					// Event specific argument
+} trace_record_t;
+
+#if CONFIG_EBIKE_TRACE_ENABLE
+
+#define TRACE_RING_SIZE      CONFIG_EBIKE_TRACE_RING_SIZE
+#define TRACE_RING_MASK      (TRACE_RING_SIZE - 1)
+
+// Per-core ring. head counts every record ever written and only wraps
+// through TRACE_RING_MASK when indexing, so the reader knows how many
+// records are valid.
+typedef struct {
+    uint32_t head;
+    trace_record_t records[TRACE_RING_SIZE];
+} trace_ring_t;
+
+extern trace_ring_t trace_rings[portNUM_PROCESSORS];
+extern volatile bool trace_running;
+
+// Hot path: no locks, no calls. The slot is reserved with an atomic add so
+// an ISR preempting a task on the same core gets its own slot.
+static inline __attribute__((always_inline)) void trace_emit(uint8_t event, uint8_t phase, uint16_t arg) {
+    if (!trace_running) return;
+
+    trace_ring_t *ring = &trace_rings[esp_cpu_get_core_id()];
+    uint32_t slot = __atomic_fetch_add(&ring->head, 1, __ATOMIC_RELAXED) & TRACE_RING_MASK;
+    trace_record_t *rec = &ring->records[slot];
+    rec->cycles = esp_cpu_get_cycle_count();
+    rec->event = event;
+    rec->phase = phase;
+    rec->arg = arg;
+}
+
+#define TRACE_BEGIN(ev, arg)     trace_emit((ev), TRACE_PHASE_BEGIN, (uint16_t)(arg))
+#define TRACE_END(ev, arg)       trace_emit((ev), TRACE_PHASE_END, (uint16_t)(arg))
+#define TRACE_INSTANT(ev, arg)   trace_emit((ev), TRACE_PHASE_INSTANT, (uint16_t)(arg))
+
+#else
+
+#define TRACE_BEGIN(ev, arg)     do { (void)(arg); } while (0)
+#define TRACE_END(ev, arg)       do { (void)(arg); } while (0)
+#define TRACE_INSTANT(ev, arg)   do { (void)(arg); } while (0)
+
+#endif 				// CONFIG_EBIKE_TRACE_ENABLE
+
+// Stop/resume recording. Dumping stops recording while it reads the rings.
+void trace_start(void);
+void trace_stop(void);
+void trace_clear(void);
+
+// Print all rings to stdout (UART) in the text format read by tools/trace2chrome.py
+void trace_dump(void);
+
+// Register the "trace" console command (call after the REPL is created)
+esp_err_t trace_register_console_cmd(void);
+
+#ifdef __cplusplus
+}
+#endif
+
+#endif 				// TRACE_H
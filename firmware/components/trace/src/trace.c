@@ -0,0 +1,152 @@
+#include "trace.h"
+#include <stdio.h>
+#include <string.h>
+#if !CONFIG_IDF_TARGET_LINUX
+#include "esp_console.h"
+#include "esp_rom_sys.h"
+#include "esp_timer.h"
+#include "esp_ipc.h"
+#endif
+
+#if CONFIG_EBIKE_TRACE_ENABLE
+
+// Names printed in the dump header, indexed by trace_event_t
+static const char *const trace_event_names[TRACE_EV_MAX] = {
+    [TRACE_EV_NONE] = "none",
+    [TRACE_EV_HALL_ISR] = "hall_isr",
+    [TRACE_EV_PEDAL_ISR] = "pedal_isr",
+    [TRACE_EV_CONTROL_TICK] = "control_tick",
+    [TRACE_EV_ADC_READ] = "adc_read",
+    [TRACE_EV_DISPLAY_FLUSH] = "display_flush",
+    [TRACE_EV_RC522_XFER] = "rc522_xfer",
+};
+
+_Static_assert((TRACE_RING_SIZE & TRACE_RING_MASK) == 0, "CONFIG_EBIKE_TRACE_RING_SIZE must be a power of two");
+
+trace_ring_t trace_rings[portNUM_PROCESSORS];
+volatile bool trace_running = true;
+
+// The cores' CCOUNTs are not synchronized. When recording stops each core
+// pairs its own CCOUNT with esp_timer, which both share, and the decoder
+// places that core's records on the esp_timer time line from there.
+typedef struct {
+    uint32_t cycles;
+    int64_t time_us;
+} trace_anchor_t;
+
+static trace_anchor_t trace_anchors[portNUM_PROCESSORS];
+
+static void trace_anchor_this_core(void *arg) {
+    static portMUX_TYPE lock = portMUX_INITIALIZER_UNLOCKED;
+    trace_anchor_t *anchor = &trace_anchors[esp_cpu_get_core_id()];
+
+    portENTER_CRITICAL(&lock);
+    anchor->time_us = esp_timer_get_time();
+    anchor->cycles = esp_cpu_get_cycle_count();
+    portEXIT_CRITICAL(&lock);
+}
+
+static void trace_anchor(void) {
+#if CONFIG_FREERTOS_UNICORE
+    trace_anchor_this_core(NULL);
+#else
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        esp_ipc_call_blocking(core, trace_anchor_this_core, NULL);
+    }
+#endif
+}
+
+void trace_start(void) {
+    trace_running = true;
+}
+
+void trace_stop(void) {
+    if (trace_running) {
+        trace_running = false;
+        trace_anchor();
+    }
+}
+
+void trace_clear(void) {
+    bool was_running = trace_running;
+    trace_running = false;
+    memset(trace_rings, 0, sizeof(trace_rings));
+    trace_running = was_running;
+}
+
+void trace_dump(void) {
+    bool was_running = trace_running;
+    trace_stop();
+
+    printf("# ebike-trace v1 cpu_mhz=%lu cores=%d ring=%d\n",
+           (unsigned long)esp_rom_get_cpu_ticks_per_us(), portNUM_PROCESSORS, TRACE_RING_SIZE);
+    for (int ev = 0; ev < TRACE_EV_MAX; ev++) {
+        printf("# event %d %s\n", ev, trace_event_names[ev]);
+    }
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        printf("# anchor %d %08lx %lld\n", core, (unsigned long)trace_anchors[core].cycles,
+               (long long)trace_anchors[core].time_us);
+    }
+
+    for (int core = 0; core < portNUM_PROCESSORS; core++) {
+        const trace_ring_t *ring = &trace_rings[core];
+        uint32_t head = ring->head;
+        uint32_t count = head < TRACE_RING_SIZE ? head : TRACE_RING_SIZE;
+
+        // Oldest record first so the decoder can unwrap CCOUNT
+        for (uint32_t i = head - count; i != head; i++) {
+            const trace_record_t *rec = &ring->records[i & TRACE_RING_MASK];
+            printf("T%d %08lx %02x %u %04x\n", core, (unsigned long)rec->cycles,
+                   rec->event, rec->phase, rec->arg);
+        }
+    }
+    printf("# end\n");
+
+    trace_running = was_running;
+}
+
+#else
+
+void trace_start(void) {}
+void trace_stop(void) {}
+void trace_clear(void) {}
+
+void trace_dump(void) {
+    printf("# ebike-trace disabled (CONFIG_EBIKE_TRACE_ENABLE=n)\n");
+}
+
+#endif 				// CONFIG_EBIKE_TRACE_ENABLE
+
+#if !CONFIG_IDF_TARGET_LINUX
+static int trace_cmd(int argc, char **argv) {
+    const char *action = argc > 1 ? argv[1] : "dump";
+
+    if (strcmp(action, "dump") == 0) {
+        trace_dump();
+    } else if (strcmp(action, "clear") == 0) {
+        trace_clear();
+    } else if (strcmp(action, "start") == 0) {
+        trace_start();
+    } else if (strcmp(action, "stop") == 0) {
+        trace_stop();
+    } else {
+        printf("usage: trace [dump|clear|start|stop]\n");
+        return 1;
+    }
+    return 0;
+}
+
+esp_err_t trace_register_console_cmd(void) {
+    const esp_console_cmd_t cmd = {
+        .command = "trace",
+        .help = "Hot-path trace: dump (default), clear, start, stop",
+        .hint = "[dump|clear|start|stop]",
+        .func = trace_cmd,
+    };
+    return esp_console_cmd_register(&cmd);
+}
+#else
+esp_err_t trace_register_console_cmd(void) {
+    return ESP_ERR_NOT_SUPPORTED;
+}
+#endif
@@ -0,0 +1,88 @@
+#!/usr/bin/env python3
+"""Expand compact deferred-log lines ("@D ...") into readable messages.
+
+The format table is read from components/dlog/include/dlog_formats.def, so
+the decoder always matches the firmware built from the same tree. Other
+lines are passed through unchanged.
+
+Usage:
+    idf.py monitor | python3 tools/dlog_decode.py
+    python3 tools/dlog_decode.py ride.log
+"""
+
+import argparse
+import os
+import re
+import struct
+import sys
+
+DEFAULT_DEF = os.path.join(os.path.dirname(os.path.abspath(__file__)),
+                           "..", "components", "dlog", "include", "dlog_formats.def")
+
+ENTRY_RE = re.compile(r'^\s*DLOG_FORMAT\(\s*(\w+)\s*,\s*"((?:[^"\\]|\\.)*)"\s*,\s*"((?:[^"\\]|\\.)*)"\s*\)')
+LINE_RE = re.compile(r"@D ([0-9a-fA-F]{8}) ([NEWIDV]) (\d+)((?: [0-9a-fA-F]+)*)")
+SPEC_RE = re.compile(r"%([-+ #0-9.]*)(?:hh|h|ll|l|z|j|t)?([diuxXcofeEgG%])")
+
+
+def load_formats(path):
+    formats = []
+    with open(path) as f:
+        for line in f:
+            m = ENTRY_RE.match(line)
+            if m:
+                fmt = bytes(m.group(3), "utf-8").decode("unicode_escape")
+                formats.append((m.group(1), m.group(2), fmt))
+    return formats
+
+
+def render(fmt, args):
+    args = list(args)
+
+    def conv(m):
+        flags, kind = m.group(1), m.group(2)
+        if kind == "%":
+            return "%"
+        value = args.pop(0) if args else 0
+        if kind in "di":
+            value = value - (1 << 32) if value & 0x80000000 else value
+            return ("%" + flags + "d") % value
+        if kind in "feEgG":
+            return ("%" + flags + kind) % struct.unpack("<f", struct.pack("<I", value))[0]
+        if kind == "c":
+            return chr(value & 0xFF)
+        return ("%" + flags + kind) % value
+
+    return SPEC_RE.sub(conv, fmt)
+
+
+def decode_line(line, formats):
+    m = LINE_RE.search(line)
+    if not m:
+        return line
+    timestamp_us = int(m.group(1), 16)
+    level = m.group(2)
+    fmt_id = int(m.group(3))
+    args = [int(a, 16) for a in m.group(4).split()]
+
+    if fmt_id >= len(formats):
+        return "%s (%d) dlog: unknown format %d %s\n" % (level, timestamp_us // 1000, fmt_id, args)
+    _, tag, fmt = formats[fmt_id]
+    return "%s (%d) %s: %s\n" % (level, timestamp_us // 1000, tag, render(fmt, args))
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", nargs="?", default="-", help="captured log (default: stdin)")
+    parser.add_argument("--formats", default=DEFAULT_DEF, help="path to dlog_formats.def")
+    args = parser.parse_args()
+
+    formats = load_formats(args.formats)
+    src = sys.stdin if args.log == "-" else open(args.log, errors="replace")
+    with src:
+        for line in src:
+            sys.stdout.write(decode_line(line, formats))
+            sys.stdout.flush()
+
+
+if __name__ == "__main__":
+    main()
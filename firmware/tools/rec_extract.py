@@ -0,0 +1,126 @@
+#!/usr/bin/env python3
+"""Extract a ride recording from monitor output ("@R ..." lines).
+
+The recorder prints its stream as hex between "@R begin" (flash dump) or
+the first "@R" line and "@R end". The result is the raw binary stream
+read by test/replay. Pass --info to summarize the records instead.
+
+Usage:
+    idf.py monitor | tee ride.log        # then "rec start" ... "rec stop"
+    python3 tools/rec_extract.py ride.log -o ride.bin
+    python3 tools/rec_extract.py ride.bin --info
+"""
+
+import argparse
+import re
+import sys
+
+LINE_RE = re.compile(r"@R ([0-9a-fA-F]+)\s*$")
+MAGIC = b"EBR2"
+TYPES = ("tick", "edge", "rfid", "gap", "auth", "profile")
+RFID_ARG_AUTH = 63
+RFID_ARG_PROFILE = 62
+PROFILE_LEN = 28
+
+
+def extract(lines):
+    """Return the last complete stream found in the log."""
+    streams = []
+    current = None
+    for line in lines:
+        if "@R begin" in line:
+            current = bytearray()
+            continue
+        if "@R end" in line:
+            if current is not None:
+                streams.append(bytes(current))
+            current = None
+            continue
+        m = LINE_RE.search(line)
+        if m:
+            data = bytes.fromhex(m.group(1))
+            if current is None and data.startswith(MAGIC):
+                current = bytearray()
+            if current is not None:
+                current += data
+    if current:
+        streams.append(bytes(current))  # Recording still running
+    return streams[-1] if streams else b""
+
+
+def read_varint(data, pos):
+    value = shift = 0
+    while True:
+        if pos >= len(data):
+            raise ValueError("truncated varint")
+        b = data[pos]
+        pos += 1
+        value |= (b & 0x7F) << shift
+        shift += 7
+        if not b & 0x80:
+            return (value >> 1) ^ -(value & 1), pos
+
+
+def records(data):
+    """Yield (type, time_us, arg, payload) like rec_decode()."""
+    if not data.startswith(MAGIC):
+        raise ValueError("not a ride recording")
+    pos = len(MAGIC)
+    now = 0
+    while pos < len(data) and data[pos] != 0xFF:
+        kind, arg = data[pos] >> 6, data[pos] & 0x3F
+        delta, pos = read_varint(data, pos + 1)
+        now += delta
+        if kind == 2 and arg == RFID_ARG_AUTH:
+            kind, size = 4, 1
+        elif kind == 2 and arg == RFID_ARG_PROFILE:
+            kind, size = 5, PROFILE_LEN
+        else:
+            size = 3 if kind == 0 else arg if kind == 2 else 0
+        payload = data[pos:pos + size]
+        if len(payload) != size:
+            raise ValueError("truncated record")
+        pos += size
+        yield TYPES[kind], now, arg, payload
+
+
+def info(data):
+    counts = dict.fromkeys(TYPES, 0)
+    lost = 0
+    first = last = None
+    for kind, now, arg, payload in records(data):
+        counts[kind] += 1
+        lost += arg if kind == "gap" else 0
+        first = now if first is None else first
+        last = now
+    span = (last - first) / 1e6 if first is not None else 0.0
+    print(f"{len(data)} bytes, {span:.3f} s, "
+          + ", ".join(f"{n} {k}" for k, n in counts.items())
+          + f", {lost} records lost")
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("input", nargs="?", help="monitor log or .bin (default: stdin)")
+    parser.add_argument("-o", "--output", help="binary stream to write")
+    parser.add_argument("--info", action="store_true", help="summarize the recording")
+    args = parser.parse_args()
+
+    if args.input and args.input.endswith(".bin"):
+        with open(args.input, "rb") as f:
+            data = f.read()
+    else:
+        with open(args.input, errors="replace") if args.input else sys.stdin as f:
+            data = extract(f)
+
+    if not data:
+        sys.exit("no recording found")
+    if args.output:
+        with open(args.output, "wb") as f:
+            f.write(data)
+    if args.info or not args.output:
+        info(data)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,150 @@
+#!/usr/bin/env python3
+"""Convert an ebike-trace dump (output of the "trace dump" console command)
+into Chrome trace JSON, viewable in chrome://tracing or https://ui.perfetto.dev
+
+Usage:
+    idf.py monitor | tee ride.log     # then type "trace" in the console
+    python3 trace2chrome.py ride.log -o ride.json
+"""
+
+import argparse
+import json
+import re
+import sys
+
+HEADER_RE = re.compile(r"# ebike-trace v1 cpu_mhz=(\d+) cores=(\d+) ring=(\d+)")
+EVENT_RE = re.compile(r"# event (\d+) (\S+)")
+ANCHOR_RE = re.compile(r"# anchor (\d+) ([0-9a-fA-F]{8}) (-?\d+)")
+RECORD_RE = re.compile(r"T(\d+) ([0-9a-fA-F]{8}) ([0-9a-fA-F]{2}) (\d) ([0-9a-fA-F]{4})")
+
+PHASES = {0: "B", 1: "E", 2: "i"}
+
+
+def parse_dump(lines):
+    """Return (cpu_mhz, event_names, {core: [(cycles, event, phase, arg), ...]},
+    {core: (cycles, esp_timer_us)}) for the last complete dump found in the log."""
+    cpu_mhz = None
+    names = {}
+    cores = {}
+    anchors = {}
+    in_dump = False
+
+    for line in lines:
+        # Monitor output may carry ANSI colors or a log prefix
+        line = re.sub(r"\x1b\[[0-9;]*m", "", line).strip()
+
+        m = HEADER_RE.search(line)
+        if m:
+            cpu_mhz = int(m.group(1))
+            names = {}
+            cores = {}
+            anchors = {}
+            in_dump = True
+            continue
+        if not in_dump:
+            continue
+        if line.startswith("# end"):
+            in_dump = False
+            continue
+        m = EVENT_RE.search(line)
+        if m:
+            names[int(m.group(1))] = m.group(2)
+            continue
+        m = ANCHOR_RE.search(line)
+        if m:
+            anchors[int(m.group(1))] = (int(m.group(2), 16), int(m.group(3)))
+            continue
+        m = RECORD_RE.search(line)
+        if m:
+            core = int(m.group(1))
+            cores.setdefault(core, []).append(
+                (int(m.group(2), 16), int(m.group(3), 16), int(m.group(4)), int(m.group(5), 16)))
+
+    if cpu_mhz is None:
+        raise ValueError("no ebike-trace header found")
+    return cpu_mhz, names, cores, anchors
+
+
+def unwrap(records):
+    """CCOUNT is 32 bits and wraps every ~17.9 s at 240 MHz. Records are
+    oldest-first, so every backwards step is one wrap."""
+    offset = 0
+    last = None
+    for cycles, event, phase, arg in records:
+        if last is not None and cycles < last:
+            offset += 1 << 32
+        last = cycles
+        yield offset + cycles, event, phase, arg
+
+
+def to_us(cpu_mhz, cores, anchors):
+    """Place every record on one time line, in microseconds.
+
+    The two cores' CCOUNTs are not synchronized, so each core is mapped
+    through its own anchor: a CCOUNT taken together with esp_timer when
+    recording stopped. The anchor must be less than one CCOUNT wrap after
+    the core's last record. Dumps without anchors keep each core on its own
+    CCOUNT, and then the tracks of different cores can't be compared."""
+    timed = {}
+    for core, recs in cores.items():
+        recs = list(unwrap(recs))
+        if not recs:
+            continue
+        if core in anchors:
+            anchor_cycles, anchor_us = anchors[core]
+            last_raw = cores[core][-1][0]
+            end = recs[-1][0] + ((anchor_cycles - last_raw) & 0xFFFFFFFF)
+            timed[core] = [(anchor_us - (end - c) / cpu_mhz, e, p, a) for c, e, p, a in recs]
+        else:
+            timed[core] = [(c / cpu_mhz, e, p, a) for c, e, p, a in recs]
+
+    if len(timed) > 1 and any(core not in anchors for core in timed):
+        print("warning: no esp_timer anchor in the dump, cores are not aligned", file=sys.stderr)
+    return timed
+
+
+def to_chrome(cpu_mhz, names, cores, anchors):
+    events = []
+    timed = to_us(cpu_mhz, cores, anchors)
+    origin = min((recs[0][0] for recs in timed.values()), default=0)
+
+    for core, recs in sorted(timed.items()):
+        events.append({"name": "thread_name", "ph": "M", "pid": 0, "tid": core,
+                       "args": {"name": "core %d" % core}})
+        for time_us, event, phase, arg in recs:
+            ev = {
+                "name": names.get(event, "event_%d" % event),
+                "ph": PHASES.get(phase, "i"),
+                "ts": time_us - origin,
+                "pid": 0,
+                "tid": core,
+                "args": {"arg": arg},
+            }
+            if ev["ph"] == "i":
+                ev["s"] = "t"
+            events.append(ev)
+
+    return {"traceEvents": events, "displayTimeUnit": "ns"}
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__, formatter_class=argparse.RawDescriptionHelpFormatter)
+    parser.add_argument("log", help="captured UART log containing a trace dump ('-' for stdin)")
+    parser.add_argument("-o", "--output", default="-", help="output JSON file (default: stdout)")
+    args = parser.parse_args()
+
+    src = sys.stdin if args.log == "-" else open(args.log, errors="replace")
+    with src:
+        cpu_mhz, names, cores, anchors = parse_dump(src)
+
+    trace = to_chrome(cpu_mhz, names, cores, anchors)
+    dst = sys.stdout if args.output == "-" else open(args.output, "w")
+    with dst:
+        json.dump(trace, dst)
+
+    count = sum(len(r) for r in cores.values())
+    print("%d records from %d core(s)" % (count, len(cores)), file=sys.stderr)
+
+
+if __name__ == "__main__":
+    main()
@@ -0,0 +1,112 @@
+#include <stdio.h>
+#include <inttypes.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "esp_log.h"
+#include "esp_cpu.h"
+#include "esp_rom_sys.h"
+#include "dlog.h"
+
+// Compares the worst-case control-tick time of the firmware with ESP_LOGI
+// against the deferred logger. The tick does the same float PID work as
+// motor_control_task() and logs the blind spot message every pass, which is
+// what happens while a blind spot is detected.
+
+#define PID_UPDATE_MS      50
+#define TICKS              200
+#define KP                 1.0
+#define KI                 0.1
+#define KD                 0.05
+#define MAX_SPEED_RPM      300
+
+typedef enum {
+    LOGGER_ESP_LOG,
+    LOGGER_DLOG,
+} logger_t;
+
+typedef struct {
+    uint32_t min_cycles;
+    uint32_t max_cycles;
+    uint64_t total_cycles;
+} tick_stats_t;
+
+static volatile bool background_running;
+static volatile float sink;
+
+// Other tasks logging at the same time, as the RFID and display paths do
+static void background_logger(void *arg) {
+    while (background_running) {
+        ESP_LOGI("RFID", "background message to keep the UART busy");
+        vTaskDelay(pdMS_TO_TICKS(5));
+    }
+    vTaskDelete(NULL);
+}
+
+static void control_tick(logger_t logger, float *integral, float *last_error) {
+    float target = (MAX_SPEED_RPM * 55) / 100.0f;
+    float error = target - 120.0f;
+    *integral += error * (PID_UPDATE_MS / 1000.0f);
+    float derivative = (error - *last_error) / (PID_UPDATE_MS / 1000.0f);
+    sink = (KP * error + KI * *integral + KD * derivative) / MAX_SPEED_RPM;
+    *last_error = error;
+
+    if (logger == LOGGER_ESP_LOG) {
+        ESP_LOGI("BLIND_SPOT", "Right blind spot detected!");
+    } else {
+        DLOGI(BLIND_SPOT_RIGHT);
+    }
+}
+
+static tick_stats_t run(logger_t logger) {
+    tick_stats_t stats = { .min_cycles = UINT32_MAX };
+    float integral = 0, last_error = 0;
+    TickType_t wake = xTaskGetTickCount();
+
+    for (int i = 0; i < TICKS; i++) {
+        uint32_t start = esp_cpu_get_cycle_count();
+        control_tick(logger, &integral, &last_error);
+        uint32_t cycles = esp_cpu_get_cycle_count() - start;
+
+        if (cycles < stats.min_cycles) stats.min_cycles = cycles;
+        if (cycles > stats.max_cycles) stats.max_cycles = cycles;
+        stats.total_cycles += cycles;
+
+        vTaskDelayUntil(&wake, pdMS_TO_TICKS(PID_UPDATE_MS));
+    }
+    return stats;
+}
+
+static void report(const char *name, const tick_stats_t *stats) {
+    uint32_t mhz = esp_rom_get_cpu_ticks_per_us();
+    printf("%-22s min %6" PRIu32 " us  avg %6" PRIu32 " us  max %6" PRIu32 " us\n", name,
+           stats->min_cycles / mhz, (uint32_t)(stats->total_cycles / TICKS / mhz), stats->max_cycles / mhz);
+}
+
+void app_main(void) {
+    // Same priority as motor_control_task in the firmware
+    vTaskPrioritySet(NULL, 5);
+    dlog_init();
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    printf("Control tick with logging, %d ticks of %d ms\n", TICKS, PID_UPDATE_MS);
+
+    tick_stats_t esp_idle = run(LOGGER_ESP_LOG);
+    tick_stats_t dlog_idle = run(LOGGER_DLOG);
+
+    background_running = true;
+    xTaskCreate(background_logger, "bg_log", 3072, NULL, 4, NULL);
+    tick_stats_t esp_busy = run(LOGGER_ESP_LOG);
+    tick_stats_t dlog_busy = run(LOGGER_DLOG);
+    background_running = false;
+
+    vTaskDelay(pdMS_TO_TICKS(100));
+    dlog_flush();
+
+    printf("\n--- Results ---\n");
+    report("ESP_LOGI", &esp_idle);
+    report("DLOGI", &dlog_idle);
+    report("ESP_LOGI, busy UART", &esp_busy);
+    report("DLOGI, busy UART", &dlog_busy);
+    printf("dlog dropped: %" PRIu32 "\n", dlog_dropped());
+    printf("Test completed.\n");
+}
@@ -0,0 +1,451 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "motor_control.h"
+#include "turn_signals.h"
+#include "display.h"
+#include "lcd_nokia5110.h"
+#include "hal_spi_prof.h"
+#include "replay.h"
+#include "rc522_crc.h"
+#include "auth.h"
+#include "rider_profile.h"
+#include "rfid_mock.h"
+#include "sdkconfig.h"
+#include "host_test.h"
+
+#define BENCH_TICKS          100000
+#define BENCH_FRAMES         2000
+#define DISPLAY_SPI_HZ       4000000
+#define BENCH_DRAWS          20000
+#define RC522_SPI_HZ         5000000
+
+// SPI traffic of the PCD's CalcCRC command without an IRQ pin: stop,
+// clear DivIrqReg (read and write), flush, FIFO write, start, one poll,
+// stop and the two result registers, 2 bytes each but the FIFO write
+#define PCD_CRC_TRANSACTIONS 10
+#define PCD_CRC_BYTES(n)     (18 + 1 + (n))
+
+// Host-side cost of the control tick and a display frame. These are
+// regression numbers for the logic, not ESP32 timings.
+static void bench_control_tick(void) {
+    hal_mock_ain_set(POTENTIOMETER_ADC, 2048);
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, 1);
+
+    int64_t start = host_test_now_ns();
+    for (int i = 0; i < BENCH_TICKS; i++) {
+        host_test_pulse(PEDAL_HALL_PIN);
+        host_test_pulse(HALL1_PIN);
+        motor_control_tick();
+        hal_mock_time_advance_us(PID_UPDATE_MS * 1000);
+    }
+    int64_t elapsed = host_test_now_ns() - start;
+
+    printf("bench control_tick: %d ticks, %.1f ns/tick\n", BENCH_TICKS, (double)elapsed / BENCH_TICKS);
+}
+
+// Full render path into the PCD8544 emulator. Frames per second are host
+// numbers; the wire time is for the 4 MHz bus only, the per-transaction
+// driver overhead comes on top on target (see test/lcd_test).
+static void print_display_bench(const char *name, int frames, int64_t elapsed_ns, lcd_nokia5110_emu_t *emu) {
+    uint32_t transactions = emu->cmd_transactions + emu->data_transactions;
+    uint32_t bytes = emu->cmd_bytes + emu->data_bytes;
+    printf("bench display %s: %d frames, %.1f us/frame (%.0f fps), %.1f SPI transactions and %.1f bytes per frame (%.0f us on the wire at 4 MHz)\n",
+           name, frames, (double)elapsed_ns / frames / 1000.0, frames * 1e9 / (double)elapsed_ns,
+           (double)transactions / frames, (double)bytes / frames,
+           (double)bytes / frames * 8 * 1e6 / DISPLAY_SPI_HZ);
+    lcd_nokia5110_emu_clear_counts(emu);
+}
+
+static void bench_display_frame(void) {
+    static lcd_nokia5110_emu_t emu;
+    lcd_nokia5110_emu_attach(&emu, DISPLAY_DC_PIN);
+    display_init();
+
+    display_status_t status = {
+        .battery_voltage = 36.5f,
+        .speed_kmh = 24.8f,
+        .assist_level = 55,
+        .turn = TURN_LEFT,
+    };
+
+    // Riding screen drawn from the idle screen
+    display_show_waiting();
+    lcd_nokia5110_emu_clear_counts(&emu);
+    int64_t start = host_test_now_ns();
+    display_update(&status);
+    print_display_bench("first frame", 1, host_test_now_ns() - start, &emu);
+
+    // Typical riding: speed moves every frame, battery sags slowly
+    start = host_test_now_ns();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        status.speed_kmh = 20.0f + (float)(i % 100) / 10.0f;
+        status.battery_voltage = 36.5f - (float)(i / 200) / 10.0f;
+        display_update(&status);
+    }
+    print_display_bench("speed/battery update", BENCH_FRAMES, host_test_now_ns() - start, &emu);
+
+    // Stopped at a light: nothing changes
+    start = host_test_now_ns();
+    for (int i = 0; i < BENCH_FRAMES; i++) {
+        display_update(&status);
+    }
+    print_display_bench("unchanged", BENCH_FRAMES, host_test_now_ns() - start, &emu);
+
+    const char *dir = getenv("HOST_TEST_FRAMES");
+    if (dir) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/bench_last.pbm", dir);
+        lcd_nokia5110_emu_write_pbm(&emu, path);
+    }
+    lcd_nokia5110_emu_detach();
+}
+
+// Two minutes of riding on the mock clock, refreshed at the fixed 5 Hz of
+// the old main loop and by the governor: parked, accelerating, cruising
+// with a turn signal, stopping and parked again
+static float bench_ride_speed(int64_t t_ms, turn_state_t *turn) {
+    *turn = t_ms >= 60000 && t_ms < 70000 ? TURN_LEFT : TURN_NONE;
+    if (t_ms < 20000) return 0.0f;
+    if (t_ms < 30000) return (float)(t_ms - 20000) * 25.0f / 10000.0f;
+    if (t_ms < 90000) return 25.0f + (float)((t_ms / 700) % 3) * 0.1f;
+    if (t_ms < 100000) return 25.0f - (float)(t_ms - 90000) * 25.0f / 10000.0f;
+    return 0.0f;
+}
+
+static void bench_display_ride(const char *name, bool governed) {
+    const int64_t ride_ms = 120000;
+    display_init();
+    display_status_t status = { .battery_voltage = 38.0f, .assist_level = 50 };
+    display_update(&status);
+    display_clear_stats();
+
+    int64_t t0 = hal_time_us();
+    for (int64_t t_ms = 0; t_ms < ride_ms; ) {
+        status.speed_kmh = bench_ride_speed(t_ms, &status.turn);
+        display_update(&status);
+        uint32_t period = governed ? display_refresh_ms() : 200;
+        hal_mock_time_advance_us((int64_t)period * 1000);
+        t_ms = (hal_time_us() - t0) / 1000;
+    }
+
+    lcd_nokia5110_stats_t stats;
+    display_get_stats(&stats);
+    printf("bench display ride %s: %lu frames (%.1f fps), %lu flushes, %lu bytes, %.3f%% bus at 4 MHz\n",
+           name, (unsigned long)stats.frames, stats.frames * 1000.0 / ride_ms, (unsigned long)stats.flushes,
+           (unsigned long)stats.bytes, stats.bytes * 8.0 * 1e3 / DISPLAY_SPI_HZ / ride_ms * 100.0);
+}
+
+static void bench_display_governor(void) {
+    static lcd_nokia5110_emu_t emu;
+    lcd_nokia5110_emu_attach(&emu, DISPLAY_DC_PIN);
+    bench_display_ride("fixed 5 Hz", false);
+    bench_display_ride("governor", true);
+    lcd_nokia5110_emu_detach();
+}
+
+// Bus cost of the same frames on each panel backend, from the driver
+// stats. I2C sends 9 bits per byte plus the address byte and start/stop
+// per transaction; the frame rate is what the bus alone allows.
+typedef struct {
+    const char *name;
+    lcd_nokia5110_config_t config;
+    uint32_t bus_hz;
+    bool i2c;
+} bench_panel_t;
+
+static double bench_wire_us(const bench_panel_t *panel, const lcd_nokia5110_stats_t *stats) {
+    double bits = panel->i2c ? (stats->bytes + stats->transactions) * 9.0 + stats->transactions * 2.0
+                             : stats->bytes * 8.0;
+    return bits * 1e6 / panel->bus_hz;
+}
+
+static void print_panel_bench(const bench_panel_t *panel, const char *name, int frames, lcd_nokia5110_t lcd) {
+    lcd_nokia5110_stats_t stats;
+    lcd_nokia5110_get_stats(lcd, &stats);
+    double us = bench_wire_us(panel, &stats) / frames;
+    printf("bench panel %s %s: %.1f transactions and %.1f bytes per frame, %.0f us on the wire (%.0f fps)\n",
+           panel->name, name, (double)stats.transactions / frames, (double)stats.bytes / frames,
+           us, us > 0 ? 1e6 / us : 0.0);
+    lcd_nokia5110_clear_stats(lcd);
+}
+
+static void bench_display_panels(void) {
+    static const bench_panel_t panels[] = {
+        { "pcd8544 spi 4 MHz", { .panel = LCD_NOKIA5110_PANEL_PCD8544, .pin_sclk = DISPLAY_CLK_PIN,
+                                 .pin_din = DISPLAY_DIN_PIN, .pin_dc = DISPLAY_DC_PIN,
+                                 .pin_rst = DISPLAY_RST_PIN, .spi_host = DISPLAY_SPI_HOST }, 4000000, false },
+        { "ssd1306 i2c 400 kHz", { .panel = LCD_NOKIA5110_PANEL_SSD1306, .clock_hz = 400000 }, 400000, true },
+        { "ssd1306 i2c 1 MHz", { .panel = LCD_NOKIA5110_PANEL_SSD1306, .clock_hz = 1000000 }, 1000000, true },
+    };
+
+    for (size_t p = 0; p < sizeof(panels) / sizeof(panels[0]); p++) {
+        lcd_nokia5110_t lcd;
+        lcd_nokia5110_init(&panels[p].config, &lcd);
+        lcd_nokia5110_clear_stats(lcd);
+
+        lcd_nokia5110_invalidate(lcd);
+        lcd_nokia5110_update(lcd);
+        print_panel_bench(&panels[p], "full frame", 1, lcd);
+
+        // Speed in the large digits and the battery, as on the riding screen
+        for (int i = 0; i < BENCH_FRAMES; i++) {
+            lcd_nokia5110_set_cursor(lcd, 0, 1);
+            lcd_nokia5110_write_fixed_font(lcd, &font_digits_2x, 200 + i % 100, 1, 4, 0);
+            lcd_nokia5110_set_cursor(lcd, 30, 0);
+            lcd_nokia5110_write_fixed(lcd, 365 - i / 200, 1, 5, 0);
+            lcd_nokia5110_update(lcd);
+        }
+        print_panel_bench(&panels[p], "speed/battery update", BENCH_FRAMES, lcd);
+        lcd_nokia5110_deinit(lcd);
+    }
+}
+
+// Framebuffer cost of each graphics primitive, alternating set/clear so
+// every call really changes bytes
+typedef void (*draw_fn_t)(lcd_nokia5110_t lcd, bool on);
+
+static const uint8_t bench_bitmap[2 * 16] = {
+    0xFF, 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81, 0xFF, 0x00, 0x3C, 0x42, 0x42, 0x3C, 0x00,
+    0xFF, 0x81, 0x42, 0x24, 0x18, 0x18, 0x24, 0x42, 0x81, 0xFF, 0x00, 0x3C, 0x42, 0x42, 0x3C, 0x00,
+};
+
+static void draw_pixel(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_pixel(lcd, 40, 21, on);
+}
+
+static void draw_hline(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_line(lcd, 2, 21, 81, 21, on);
+}
+
+static void draw_vline(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_line(lcd, 40, 2, 40, 45, on);
+}
+
+static void draw_diagonal(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_line(lcd, 2, 2, 81, 45, on);
+}
+
+static void draw_rect_outline(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_rect(lcd, 10, 5, 60, 30, false, on);
+}
+
+static void draw_rect_filled(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_rect(lcd, 10, 5, 60, 30, true, on);
+}
+
+// Same box as draw_rect_filled through the per-pixel path
+static void draw_rect_pixels(lcd_nokia5110_t lcd, bool on) {
+    for (int y = 5; y < 35; y++) {
+        for (int x = 10; x < 70; x++) {
+            lcd_nokia5110_draw_pixel(lcd, x, y, on);
+        }
+    }
+}
+
+static void draw_bitmap_unaligned(lcd_nokia5110_t lcd, bool on) {
+    lcd_nokia5110_draw_bitmap(lcd, 30, on ? 13 : 14, bench_bitmap, 16, 16);
+}
+
+static void bench_lcd_primitives(void) {
+    static const struct {
+        const char *name;
+        draw_fn_t fn;
+    } prims[] = {
+        { "pixel", draw_pixel },
+        { "hline 80 px", draw_hline },
+        { "vline 44 px", draw_vline },
+        { "diagonal 80x44", draw_diagonal },
+        { "rect 60x30", draw_rect_outline },
+        { "fill 60x30", draw_rect_filled },
+        { "fill 60x30 per pixel", draw_rect_pixels },
+        { "bitmap 16x16 y%8!=0", draw_bitmap_unaligned },
+    };
+    lcd_nokia5110_config_t config = {
+        .pin_sclk = DISPLAY_CLK_PIN,
+        .pin_din = DISPLAY_DIN_PIN,
+        .pin_dc = DISPLAY_DC_PIN,
+        .pin_cs = DISPLAY_CE_PIN,
+        .pin_rst = DISPLAY_RST_PIN,
+        .spi_host = DISPLAY_SPI_HOST,
+    };
+    lcd_nokia5110_t lcd;
+    lcd_nokia5110_init(&config, &lcd);
+
+    for (size_t p = 0; p < sizeof(prims) / sizeof(prims[0]); p++) {
+        int64_t start = host_test_now_ns();
+        for (int i = 0; i < BENCH_DRAWS; i++) {
+            prims[p].fn(lcd, i & 1);
+        }
+        int64_t elapsed = host_test_now_ns() - start;
+        printf("bench lcd %s: %.1f ns\n", prims[p].name, (double)elapsed / BENCH_DRAWS);
+    }
+    lcd_nokia5110_deinit(lcd);
+}
+
+// Speed readout the old way (format, then glyph lookups per character)
+// and straight from the digit strip
+static void bench_lcd_numbers(void) {
+    lcd_nokia5110_config_t config = {
+        .pin_sclk = DISPLAY_CLK_PIN,
+        .pin_din = DISPLAY_DIN_PIN,
+        .pin_dc = DISPLAY_DC_PIN,
+        .pin_cs = DISPLAY_CE_PIN,
+        .pin_rst = DISPLAY_RST_PIN,
+        .spi_host = DISPLAY_SPI_HOST,
+    };
+    lcd_nokia5110_t lcd;
+    lcd_nokia5110_init(&config, &lcd);
+
+    char text[8];
+    int64_t start = host_test_now_ns();
+    for (int i = 0; i < BENCH_DRAWS; i++) {
+        snprintf(text, sizeof(text), "%5.1f", (float)(i % 1000) / 10.0f);
+        lcd_nokia5110_set_cursor(lcd, 24, 1);
+        lcd_nokia5110_write_string(lcd, text);
+    }
+    int64_t snprintf_ns = host_test_now_ns() - start;
+
+    start = host_test_now_ns();
+    for (int i = 0; i < BENCH_DRAWS; i++) {
+        lcd_nokia5110_set_cursor(lcd, 24, 1);
+        lcd_nokia5110_write_fixed(lcd, i % 1000, 1, 5, 0);
+    }
+    int64_t fixed_ns = host_test_now_ns() - start;
+
+    printf("bench lcd number \"%%5.1f\": snprintf + write_string %.1f ns, write_fixed %.1f ns\n",
+           (double)snprintf_ns / BENCH_DRAWS, (double)fixed_ns / BENCH_DRAWS);
+    lcd_nokia5110_deinit(lcd);
+}
+
+static void bench_replay(void) {
+    static uint8_t ride[512 * 1024];
+    size_t len = host_test_make_ride(ride, sizeof(ride), 600);
+    replay_result_t result;
+
+    int64_t start = host_test_now_ns();
+    replay_run(ride, len, NULL, NULL, &result);
+    int64_t elapsed = host_test_now_ns() - start;
+
+    double ride_s = (double)(result.end_us - result.start_us) / 1e6;
+    printf("bench replay: %.0f s ride (%lu bytes, %.1f B/s) in %.1f ms, %.0fx real time\n",
+           ride_s, (unsigned long)len, len / ride_s, (double)elapsed / 1e6, ride_s / ((double)elapsed / 1e9));
+}
+
+// What the profiler adds to each SPI transaction (begin and end)
+static void bench_spi_profiler(void) {
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+    hal_spi_prof_t *prof = hal_spi_prof_register("bench");
+    int64_t start = host_test_now_ns();
+    for (int i = 0; i < BENCH_TICKS; i++) {
+        hal_spi_prof_begin(prof);
+        hal_spi_prof_end(prof, 1 + i % 16, true);
+    }
+    int64_t elapsed = host_test_now_ns() - start;
+    printf("bench spi profiler: %.1f ns per transaction\n", (double)elapsed / BENCH_TICKS);
+#else
+    printf("bench spi profiler: disabled\n");
+#endif
+}
+
+// Software CRC_A of a MIFARE WRITE data block against the bus time
+// alone of the coprocessor round trip it replaces
+static void bench_rc522_crc(void) {
+    uint8_t block[16] = { 0 };
+    volatile uint16_t crc = 0;
+
+    int64_t start = host_test_now_ns();
+    for (int i = 0; i < BENCH_TICKS; i++) {
+        block[0] = i;
+        crc ^= rc522_crc_a(block, sizeof(block));
+    }
+    int64_t elapsed = host_test_now_ns() - start;
+
+    printf("bench rc522 crc_a 16 bytes: %.1f ns in software, CalcCRC %d SPI transactions and %d bytes (%.0f us on the wire at 5 MHz)\n",
+           (double)elapsed / BENCH_TICKS, PCD_CRC_TRANSACTIONS, PCD_CRC_BYTES(16),
+           PCD_CRC_BYTES(16) * 8 * 1e6 / RC522_SPI_HZ);
+}
+
+// Tag decision on a full allowlist, the part of the tap-to-motor-enable
+// path that auth adds (the target logs the whole path, AUTH_GRANTED)
+static void bench_auth(void) {
+    uint8_t uid[7] = { 0x04 };
+
+    auth_init();
+    auth_check((const uint8_t[]) { 1, 2, 3, 4 }, 4); 		// Master
+    for (int i = 0; i < CONFIG_AUTH_MAX_TAGS; i++) {
+        uid[6] = i;
+        auth_add(uid, sizeof(uid));
+    }
+
+    int granted = 0;
+    int64_t start = host_test_now_ns();
+    for (int i = 0; i < BENCH_TICKS; i++) {
+        uid[6] = i % (2 * CONFIG_AUTH_MAX_TAGS); 			// Half unknown
+        granted += auth_check(uid, sizeof(uid)) == AUTH_GRANTED;
+    }
+    int64_t elapsed = host_test_now_ns() - start;
+
+    printf("bench auth_check: %d tags, %.1f ns per decision (%d%% granted)\n", CONFIG_AUTH_MAX_TAGS,
+           (double)elapsed / BENCH_TICKS, granted * 100 / BENCH_TICKS);
+}
+
+static void bench_profile_load(const uint8_t *uid, size_t len, void *ctx) {
+    rider_profile_load(uid, len, ctx);
+}
+
+// Host cost of a tap that reads and decodes the record against one that
+// hits the cache, plus the FAST_READ air time at 106 kbit/s (128/fc per
+// bit, 9 bits per byte with parity, SOF/EOF and the 1172/fc response
+// delay): 5 command bytes, 16 data bytes and CRC_A.
+static void bench_rider_profile(void) {
+    static uint8_t memory[(CONFIG_PROFILE_NTAG_PAGE + 4) * 4];
+    uint8_t uid[7] = { 0x04 };
+    rider_profile_source_t source;
+    const int taps = BENCH_TICKS / 10;
+
+    rider_profile_encode(&motor_profile_default, &memory[CONFIG_PROFILE_NTAG_PAGE * 4]);
+    rfid_init(bench_profile_load, &source);
+    rfid_mock_set_pages(memory, sizeof(memory));
+
+    int64_t start = host_test_now_ns();
+    for (int i = 0; i < taps; i++) {
+        rider_profile_clear_cache();
+        rfid_mock_present(uid, sizeof(uid));
+    }
+    int64_t read_ns = host_test_now_ns() - start;
+
+    start = host_test_now_ns();
+    for (int i = 0; i < taps; i++) {
+        rfid_mock_present(uid, sizeof(uid));
+    }
+    int64_t cached_ns = host_test_now_ns() - start;
+
+    double air_us = ((5 + RIDER_PROFILE_SIZE + 2) * 9 + 4 + 1172.0 / 128) * 128 / 13.56;
+    printf("bench rider profile: read and decode %.1f ns, cached %.1f ns per tap; FAST_READ %.0f us on the air\n",
+           (double)read_ns / taps, (double)cached_ns / taps, air_us);
+    rfid_mock_set_pages(NULL, 0);
+}
+
+void run_benchmarks(void) {
+    hal_mock_reset();
+    hal_mock_time_manual(true);
+    hal_mock_time_set_us(HOST_TEST_T0_US);
+    motor_control_reset();
+    turn_signals_reset();
+    motor_control_init();
+    turn_signals_init();
+
+    bench_control_tick();
+    bench_display_frame();
+    bench_display_panels();
+    bench_display_governor();
+    bench_spi_profiler();
+    bench_lcd_primitives();
+    bench_lcd_numbers();
+    bench_replay();
+    bench_rc522_crc();
+    bench_auth();
+    bench_rider_profile();
+}
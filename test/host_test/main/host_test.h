@@ -0,0 +1,33 @@
+#ifndef HOST_TEST_H
+#define HOST_TEST_H
+
+#include <stdint.h>
+#include <stddef.h>
+#include <stdbool.h>
+#include <time.h>
+#include "lcd_nokia5110_emu.h"
+
+// Start time of every test on the mock clock
+#define HOST_TEST_T0_US      1000000
+
+// Drive a pull-up input low and back high, firing its rising edge ISR
+void host_test_pulse(int pin);
+
+// Host wall clock for benchmarks
+static inline int64_t host_test_now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+// Compare the visible frame with a golden image of its top-left corner,
+// '#' = on, one string per pixel row. With HOST_TEST_FRAMES=<dir> in the
+// environment the frame is also written to <dir>/<name>.pbm.
+void host_test_assert_frame(const lcd_nokia5110_emu_t *emu, const char *name, const char *const *rows, int height);
+
+// Build a synthetic ride recording, returns its length
+size_t host_test_make_ride(uint8_t *buf, size_t cap, int seconds);
+
+void run_benchmarks(void);
+
+#endif 				// HOST_TEST_H
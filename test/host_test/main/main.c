@@ -0,0 +1,53 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "motor_control.h"
+#include "turn_signals.h"
+#include "supervisor.h"
+#include "host_test.h"
+
+// Every test starts from a fresh mock board on a stopped clock
+void setUp(void) {
+    hal_mock_reset();
+    hal_mock_time_manual(true);
+    hal_mock_time_set_us(HOST_TEST_T0_US);
+
+    supervisor_init();
+    motor_control_reset();
+    turn_signals_reset();
+    motor_control_init();
+    turn_signals_init();
+}
+
+void tearDown(void) {
+}
+
+void host_test_pulse(int pin) {
+    hal_mock_dio_set(pin, 0);
+    hal_mock_dio_set(pin, 1);
+}
+
+void host_test_assert_frame(const lcd_nokia5110_emu_t *emu, const char *name, const char *const *rows, int height) {
+    const char *dir = getenv("HOST_TEST_FRAMES");
+    if (dir) {
+        char path[256];
+        snprintf(path, sizeof(path), "%s/%s.pbm", dir, name);
+        lcd_nokia5110_emu_write_pbm(emu, path);
+    }
+
+    for (int y = 0; y < height; y++) {
+        for (int x = 0; rows[y][x]; x++) {
+            TEST_ASSERT_EQUAL_MESSAGE(rows[y][x] == '#', lcd_nokia5110_emu_pixel(emu, x, y), rows[y]);
+        }
+    }
+}
+
+void app_main(void) {
+    UNITY_BEGIN();
+    unity_run_all_tests();
+    int failures = UNITY_END();
+
+    run_benchmarks();
+    exit(failures);
+}
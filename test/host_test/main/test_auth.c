@@ -0,0 +1,116 @@
+#include <string.h>
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "auth.h"
+#include "sdkconfig.h"
+#include "host_test.h"
+
+static const uint8_t master_uid[4] = { 0xDE, 0xAD, 0xBE, 0xEF };
+static const uint8_t rider_uid[7] = { 0x04, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+
+static void auth_start_with_master(void) {
+    TEST_ASSERT_EQUAL(ESP_OK, auth_init());
+    TEST_ASSERT_EQUAL(AUTH_MASTER_SET, auth_check(master_uid, sizeof(master_uid)));
+}
+
+TEST_CASE("auth first tag becomes the master and never activates", "[auth]")
+{
+    TEST_ASSERT_EQUAL(ESP_OK, auth_init());
+    TEST_ASSERT_EQUAL(AUTH_MASTER_SET, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_DENIED, auth_check(rider_uid, sizeof(rider_uid)));
+    TEST_ASSERT_EQUAL(0, auth_count());
+
+    // The master programs, it is not a key
+    TEST_ASSERT_EQUAL(AUTH_ENROLL_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_FALSE(auth_is_allowed(master_uid, sizeof(master_uid)));
+}
+
+TEST_CASE("auth master tag enrolls and revokes one tag per tap", "[auth]")
+{
+    auth_start_with_master();
+
+    TEST_ASSERT_EQUAL(AUTH_ENROLL_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_MODE_ENROLL, auth_mode());
+    TEST_ASSERT_EQUAL(AUTH_ENROLLED, auth_check(rider_uid, sizeof(rider_uid)));
+    TEST_ASSERT_EQUAL(AUTH_MODE_NORMAL, auth_mode());
+    TEST_ASSERT_EQUAL(1, auth_count());
+    TEST_ASSERT_EQUAL(AUTH_GRANTED, auth_check(rider_uid, sizeof(rider_uid)));
+
+    TEST_ASSERT_EQUAL(AUTH_ENROLL_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_REVOKE_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_REVOKED, auth_check(rider_uid, sizeof(rider_uid)));
+    TEST_ASSERT_EQUAL(0, auth_count());
+    TEST_ASSERT_EQUAL(AUTH_DENIED, auth_check(rider_uid, sizeof(rider_uid)));
+
+    // A third master tap leaves program mode without touching the list
+    TEST_ASSERT_EQUAL(AUTH_ENROLL_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_REVOKE_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_PROGRAM_DONE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_DENIED, auth_check(rider_uid, sizeof(rider_uid)));
+    TEST_ASSERT_EQUAL(0, auth_count());
+}
+
+TEST_CASE("auth program mode times out", "[auth]")
+{
+    auth_start_with_master();
+
+    TEST_ASSERT_EQUAL(AUTH_ENROLL_MODE, auth_check(master_uid, sizeof(master_uid)));
+    hal_mock_time_advance_us((int64_t)CONFIG_AUTH_PROGRAM_TIMEOUT_S * 1000000);
+    TEST_ASSERT_EQUAL(AUTH_MODE_NORMAL, auth_mode());
+    TEST_ASSERT_EQUAL(AUTH_DENIED, auth_check(rider_uid, sizeof(rider_uid)));
+    TEST_ASSERT_EQUAL(0, auth_count());
+}
+
+TEST_CASE("auth tells 4, 7 and 10 byte UIDs apart", "[auth]")
+{
+    static const uint8_t uid10[10] = { 0x04, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66, 0x77, 0x88, 0x99 };
+
+    auth_start_with_master();
+    TEST_ASSERT_EQUAL(ESP_OK, auth_add(rider_uid, sizeof(rider_uid)));
+
+    // Same leading bytes, other lengths
+    TEST_ASSERT_FALSE(auth_is_allowed(rider_uid, 4));
+    TEST_ASSERT_FALSE(auth_is_allowed(uid10, sizeof(uid10)));
+    TEST_ASSERT_TRUE(auth_is_allowed(uid10, sizeof(rider_uid)));
+
+    TEST_ASSERT_EQUAL(ESP_OK, auth_add(uid10, sizeof(uid10)));
+    TEST_ASSERT_EQUAL(ESP_OK, auth_add(rider_uid, 4));
+    TEST_ASSERT_EQUAL(3, auth_count());
+    TEST_ASSERT_TRUE(auth_is_allowed(uid10, sizeof(uid10)));
+    TEST_ASSERT_TRUE(auth_is_allowed(rider_uid, 4));
+
+    // Only ISO 14443-3 UID sizes
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, auth_add(uid10, 5));
+    TEST_ASSERT_EQUAL(AUTH_DENIED, auth_check(uid10, 0));
+    TEST_ASSERT_EQUAL(AUTH_DENIED, auth_check(NULL, 4));
+}
+
+TEST_CASE("auth lookup matches a linear search up to a full table", "[auth]")
+{
+    static uint8_t uids[CONFIG_AUTH_MAX_TAGS + 1][4];
+    uint32_t seed = 7;
+
+    auth_start_with_master();
+    for (int i = 0; i <= CONFIG_AUTH_MAX_TAGS; i++) {
+        seed = seed * 1103515245 + 12345;
+        memcpy(uids[i], &seed, sizeof(uids[i]));
+    }
+
+    for (int i = 0; i < CONFIG_AUTH_MAX_TAGS; i++) {
+        TEST_ASSERT_EQUAL(ESP_OK, auth_add(uids[i], 4));
+        for (int j = 0; j <= CONFIG_AUTH_MAX_TAGS; j++) {
+            TEST_ASSERT_EQUAL(j <= i, auth_is_allowed(uids[j], 4));
+        }
+    }
+
+    TEST_ASSERT_EQUAL(ESP_ERR_NO_MEM, auth_add(uids[CONFIG_AUTH_MAX_TAGS], 4));
+    TEST_ASSERT_EQUAL(AUTH_ENROLL_MODE, auth_check(master_uid, sizeof(master_uid)));
+    TEST_ASSERT_EQUAL(AUTH_FULL, auth_check(uids[CONFIG_AUTH_MAX_TAGS], 4));
+
+    // Removing from the middle keeps the rest reachable
+    TEST_ASSERT_EQUAL(ESP_OK, auth_remove(uids[5], 4));
+    TEST_ASSERT_EQUAL(ESP_ERR_NOT_FOUND, auth_remove(uids[5], 4));
+    for (int j = 0; j < CONFIG_AUTH_MAX_TAGS; j++) {
+        TEST_ASSERT_EQUAL(j != 5, auth_is_allowed(uids[j], 4));
+    }
+}
@@ -0,0 +1,376 @@
+#include <string.h>
+#include "unity.h"
+#include "sdkconfig.h"
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "display.h"
+#include "display_governor.h"
+#include "font_5x7.h"
+#include "host_test.h"
+
+// Expected bank contents for a line of 5x7 text plus spacer columns
+static void render_line(const char *str, uint8_t *row) {
+    memset(row, 0, LCD_NOKIA5110_EMU_WIDTH);
+    for (int x = 0; *str && x + 6 <= LCD_NOKIA5110_EMU_WIDTH; str++, x += 6) {
+        memcpy(&row[x], font_5x7[*str - 32], 5);
+    }
+}
+
+static void assert_line(const lcd_nokia5110_emu_t *lcd, int row, const char *str) {
+    uint8_t expected[LCD_NOKIA5110_EMU_WIDTH];
+    render_line(str, expected);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, lcd->ram[row], LCD_NOKIA5110_EMU_WIDTH, str);
+}
+
+// 5x7 text at pixel column x, only the glyph columns are checked
+static void assert_text_at(const lcd_nokia5110_emu_t *lcd, int row, int x, const char *str) {
+    for (; *str; str++, x += 6) {
+        TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(font_5x7[*str - 32], &lcd->ram[row][x], 5, str);
+    }
+}
+
+// Large digits ("0"-"9", ".") from a digit strip, top bank at row
+static void assert_digits(const lcd_nokia5110_emu_t *lcd, const font_digits_t *font, int row, int x, const char *str) {
+    for (; *str; str++, x += font->width) {
+        int glyph = *str == '.' ? FONT_DIGIT_POINT : *str - '0';
+        const uint8_t *cell = &font->cells[glyph * font->width * font->banks];
+        for (int bank = 0; bank < font->banks; bank++) {
+            TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(&cell[bank * font->width], &lcd->ram[row + bank][x],
+                                                  font->width, str);
+        }
+    }
+}
+
+static const display_status_t riding = {
+    .battery_voltage = 36.5f,
+    .speed_kmh = 12.34f,
+    .assist_level = 55,
+    .turn = TURN_RIGHT,
+};
+
+TEST_CASE("display shows riding status", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+
+    display_update(&riding);
+
+    assert_line(&lcd, 0, "Batt: 36.5V");
+    assert_digits(&lcd, &font_digits_2x, 1, 0, "12.3");
+    assert_text_at(&lcd, 2, 54, "km/h");
+    assert_line(&lcd, 3, "Assist: 55% ->");
+    assert_line(&lcd, 4, "");
+
+    // Battery bar: 36.5 V is 65/120 of 30..42 V, 44 of 82 inner columns
+    TEST_ASSERT_EQUAL_HEX8(0xFF, lcd.ram[5][0]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, lcd.ram[5][44]);
+    TEST_ASSERT_EQUAL_HEX8(0x81, lcd.ram[5][45]);
+    TEST_ASSERT_EQUAL_HEX8(0xFF, lcd.ram[5][83]);
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display init clears the whole panel in one burst", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    memset(lcd.ram, 0xA5, sizeof(lcd.ram));
+    display_init();
+
+    for (int row = 0; row < LCD_NOKIA5110_EMU_BANKS; row++) {
+        assert_line(&lcd, row, "");
+    }
+    TEST_ASSERT_EQUAL_UINT32(LCD_NOKIA5110_EMU_BANKS * LCD_NOKIA5110_EMU_WIDTH, lcd.data_bytes);
+    TEST_ASSERT_EQUAL_UINT32(1, lcd.data_transactions);
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display sends only the changed digits", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+    display_update(&riding);
+
+    // Same values: nothing to send
+    lcd_nokia5110_emu_clear_counts(&lcd);
+    display_update(&riding);
+    TEST_ASSERT_EQUAL_UINT32(0, lcd.cmd_transactions + lcd.data_transactions);
+
+    // 12.3 -> 12.4 km/h touches one large glyph, two banks of it
+    display_status_t status = riding;
+    status.speed_kmh = 12.44f;
+    display_update(&status);
+    TEST_ASSERT_EQUAL_UINT32(2, lcd.data_transactions);
+    TEST_ASSERT_LESS_OR_EQUAL(20, lcd.data_bytes);
+    assert_digits(&lcd, &font_digits_2x, 1, 0, "12.4");
+
+    lcd_nokia5110_stats_t stats;
+    display_get_stats(&stats);
+    TEST_ASSERT_EQUAL_UINT32(3, stats.frames);
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display waiting screen", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+    display_update(&riding);
+
+    display_show_waiting();
+    assert_line(&lcd, 0, "Waiting for");
+    assert_line(&lcd, 1, "RFID tag");
+    assert_line(&lcd, 2, "");
+    assert_line(&lcd, 3, "Scan to");
+    assert_line(&lcd, 4, "activate");
+
+    // Back to riding: the waiting text must not survive
+    display_update(&riding);
+    assert_line(&lcd, 4, "");
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display turn indicator blinks without touching the rest", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+    display_update(&riding);
+
+    // Still in the first half period: nothing to send
+    lcd_nokia5110_emu_clear_counts(&lcd);
+    hal_mock_time_advance_us(400 * 1000);
+    display_update(&riding);
+    TEST_ASSERT_EQUAL_UINT32(0, lcd.cmd_transactions + lcd.data_transactions);
+
+    // Off phase blanks only the arrow
+    hal_mock_time_advance_us(200 * 1000);
+    display_update(&riding);
+    assert_line(&lcd, 3, "Assist: 55%");
+    assert_line(&lcd, 0, "Batt: 36.5V");
+    TEST_ASSERT_EQUAL_UINT32(1, lcd.data_transactions);
+    TEST_ASSERT_LESS_OR_EQUAL(12, lcd.data_bytes);
+
+    // Switching sides shows the new arrow right away
+    display_status_t status = riding;
+    status.turn = TURN_LEFT;
+    display_update(&status);
+    assert_line(&lcd, 3, "Assist: 55% <-");
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display widgets redraw only their own box on change", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+    display_update(&riding);
+    lcd_nokia5110_stats_t before;
+    display_get_stats(&before);
+
+    // Battery drop moves the number and shrinks the bar by a column or two
+    display_status_t status = riding;
+    status.battery_voltage = 36.3f;
+    lcd_nokia5110_emu_clear_counts(&lcd);
+    display_update(&status);
+    assert_line(&lcd, 0, "Batt: 36.3V");
+    TEST_ASSERT_EQUAL_HEX8(0xFF, lcd.ram[5][43]);
+    TEST_ASSERT_EQUAL_HEX8(0x81, lcd.ram[5][44]);
+    TEST_ASSERT_EQUAL_UINT32(2, lcd.data_transactions);
+    TEST_ASSERT_LESS_OR_EQUAL(8, lcd.data_bytes);
+
+    // Unchanged values after that: no flush at all
+    lcd_nokia5110_stats_t after;
+    display_get_stats(&before);
+    display_update(&status);
+    display_get_stats(&after);
+    TEST_ASSERT_EQUAL_UINT32(before.flushes, after.flushes);
+    TEST_ASSERT_EQUAL_UINT32(before.frames + 1, after.frames);
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display riding screen matches the golden frame", "[display]")
+{
+    static const char *const golden[] = {
+        "####.........#.....#...................#....#..........###..#...#...................",
+        "#...#........#.....#.....##...........##...##.........#...#.#...#...................",
+        "#...#..###..###...###....##..........#.#....#.............#.#...#...................",
+        "####......#..#.....#................#..#....#............#..#...#...................",
+        "#...#..####..#.....#.....##.........#####...#...........#...#...#...................",
+        "#...#.#...#..#..#..#..#..##............#....#....##....#.....#.#....................",
+        "####...####...##....##.................#...###...##...#####...#.....................",
+        "....................................................................................",
+        "..######....##########..............##########......................................",
+        "..######....##########..............##########......................................",
+        "##......##..........##..............##..............................................",
+        "##......##..........##..............##..............................................",
+        "........##........##................########........................................",
+        "........##........##................########........................................",
+        "......##........##..........................##......................................",
+        "......##........##..........................##......................................",
+        "....##........##............................##........#.................#...........",
+        "....##........##............................##........#...............#.#...........",
+        "..##..........##..........####......##......##........#..#..##.#.....#..#.##........",
+        "..##..........##..........####......##......##........#.#...#.#.#...#...##..#.......",
+        "##########....##..........####........######..........##....#.#.#..#....#...#.......",
+        "##########....##..........####........######..........#.#...#...#.#.....#...#.......",
+        "......................................................#..#..#...#.......#...#.......",
+        "....................................................................................",
+        ".###................#..........#.................###...###..##..............#.......",
+        "#...#..........................#.....##.........#...#.#...#.##..#..........#........",
+        "#...#..###...###...##....###..###....##.........#...#.#..##....#..........#.........",
+        "#...#.#.....#.......#...#......#.................###..#.#.#...#..........#....#####.",
+        "#####..###...###....#....###...#.....##.........#...#.##..#..#............#.........",
+        "#...#.....#.....#...#.......#..#..#..##.........#...#.#...#.#..##..........#........",
+        "#...#.####..####...###..####....##...............###...###.....##...........#.......",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "....................................................................................",
+        "####################################################################################",
+        "#############################################################################......#",
+        "#############################################################################......#",
+        "#############################################################################......#",
+        "#############################################################################......#",
+        "#############################################################################......#",
+        "#############################################################################......#",
+        "####################################################################################",
+    };
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+
+    display_status_t status = riding;
+    status.battery_voltage = 41.2f;
+    status.speed_kmh = 27.45f;
+    status.assist_level = 80;
+    status.turn = TURN_LEFT;
+    display_update(&status);
+
+    host_test_assert_frame(&lcd, "riding", golden, sizeof(golden) / sizeof(golden[0]));
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display governor speeds up on change and backs off to the heartbeat", "[display]")
+{
+    display_governor_t gov = { .fast_ms = 50, .normal_ms = 200, .slow_ms = 1000 };
+    display_governor_reset(&gov);
+    TEST_ASSERT_EQUAL_UINT32(200, gov.period_ms);
+
+    TEST_ASSERT_EQUAL_UINT32(50, display_governor_frame(&gov, DISPLAY_ACTIVITY_MAJOR, 0, UINT32_MAX));
+    // Drifting values back off to the normal period, no further
+    TEST_ASSERT_EQUAL_UINT32(100, display_governor_frame(&gov, DISPLAY_ACTIVITY_MINOR, 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(200, display_governor_frame(&gov, DISPLAY_ACTIVITY_MINOR, 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(200, display_governor_frame(&gov, DISPLAY_ACTIVITY_MINOR, 0, UINT32_MAX));
+    // Stable: doubles up to the heartbeat
+    TEST_ASSERT_EQUAL_UINT32(400, display_governor_frame(&gov, DISPLAY_ACTIVITY_NONE, 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(800, display_governor_frame(&gov, DISPLAY_ACTIVITY_NONE, 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(1000, display_governor_frame(&gov, DISPLAY_ACTIVITY_NONE, 0, UINT32_MAX));
+    // A change after the heartbeat comes back at the normal period at once
+    TEST_ASSERT_EQUAL_UINT32(200, display_governor_frame(&gov, DISPLAY_ACTIVITY_MINOR, 0, UINT32_MAX));
+
+    // Panel and blink limits win
+    TEST_ASSERT_EQUAL_UINT32(80, display_governor_frame(&gov, DISPLAY_ACTIVITY_MAJOR, 80, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(160, display_governor_frame(&gov, DISPLAY_ACTIVITY_NONE, 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(320, display_governor_frame(&gov, DISPLAY_ACTIVITY_NONE, 0, UINT32_MAX));
+    TEST_ASSERT_EQUAL_UINT32(500, display_governor_frame(&gov, DISPLAY_ACTIVITY_NONE, 0, 500));
+}
+
+TEST_CASE("display refresh period follows the riding values", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+
+    // Parked: the period climbs to the heartbeat
+    display_status_t status = riding;
+    status.turn = TURN_NONE;
+    display_update(&status);
+    for (int i = 0; i < 8; i++) {
+        hal_mock_time_advance_us(display_refresh_ms() * 1000);
+        display_update(&status);
+    }
+    TEST_ASSERT_EQUAL_UINT32(CONFIG_DISPLAY_SLOW_MS, display_refresh_ms());
+
+    // Accelerating: fast refresh
+    status.speed_kmh += 1.0f;
+    display_update(&status);
+    TEST_ASSERT_EQUAL_UINT32(CONFIG_DISPLAY_FAST_MS, display_refresh_ms());
+
+    // Cruising with small changes: normal period
+    for (int i = 0; i < 4; i++) {
+        status.speed_kmh += 0.1f;
+        display_update(&status);
+    }
+    TEST_ASSERT_EQUAL_UINT32(CONFIG_DISPLAY_NORMAL_MS, display_refresh_ms());
+
+    // A turn signal is an alert, and keeps the period short enough to blink
+    status.turn = TURN_LEFT;
+    display_update(&status);
+    TEST_ASSERT_EQUAL_UINT32(CONFIG_DISPLAY_FAST_MS, display_refresh_ms());
+    for (int i = 0; i < 8; i++) display_update(&status);
+    TEST_ASSERT_EQUAL_UINT32(500, display_refresh_ms());
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display powers the panel down while waiting for a tag", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+    display_show_waiting();
+
+    hal_mock_time_advance_us((int64_t)CONFIG_DISPLAY_SLEEP_S * 1000000 - 1);
+    display_idle();
+    TEST_ASSERT_FALSE(lcd.power_down);
+
+    // One command, display RAM untouched
+    lcd_nokia5110_emu_clear_counts(&lcd);
+    hal_mock_time_advance_us(1);
+    display_idle();
+    TEST_ASSERT_TRUE(lcd.power_down);
+    TEST_ASSERT_EQUAL_UINT32(1, lcd.cmd_transactions);
+    TEST_ASSERT_EQUAL_UINT32(0, lcd.data_transactions);
+    TEST_ASSERT_FALSE(lcd_nokia5110_emu_pixel(&lcd, 0, 1));
+    assert_line(&lcd, 0, "Waiting for");
+
+    display_rate_t rate;
+    display_get_rate(&rate);
+    TEST_ASSERT_TRUE(rate.asleep);
+
+    // A tag wakes it with the riding screen
+    display_update(&riding);
+    TEST_ASSERT_FALSE(lcd.power_down);
+    assert_line(&lcd, 0, "Batt: 36.5V");
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("display rate counts frames and flushes per second", "[display]")
+{
+    lcd_nokia5110_emu_t lcd;
+    lcd_nokia5110_emu_attach(&lcd, DISPLAY_DC_PIN);
+    display_init();
+    display_status_t status = riding;
+    status.turn = TURN_NONE;
+    display_update(&status);
+
+    // 10 frames in one second, the speed changes in every other one
+    display_rate_t rate;
+    display_get_rate(&rate);
+    for (int i = 0; i < 10; i++) {
+        if (i & 1) status.speed_kmh += 0.1f;
+        hal_mock_time_advance_us(100 * 1000);
+        display_update(&status);
+    }
+    display_get_rate(&rate);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 10.0f, rate.fps);
+    TEST_ASSERT_FLOAT_WITHIN(0.01f, 5.0f, rate.flush_fps);
+    TEST_ASSERT_FALSE(rate.asleep);
+    lcd_nokia5110_emu_detach();
+}
@@ -0,0 +1,174 @@
+#include <string.h>
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "hal_spi_shared.h"
+#include "hal_spi_prof.h"
+#include "lcd_nokia5110.h"
+#include "host_test.h"
+
+static const hal_spi_bus_config_t shared_bus = {
+    .host = 1,
+    .pin_mosi = 23,
+    .pin_miso = 19,
+    .pin_sclk = 18,
+};
+
+TEST_CASE("spi bus init is shared between compatible devices", "[hal]")
+{
+    hal_spi_bus_config_t write_only = shared_bus;
+    write_only.pin_miso = -1;
+    hal_spi_bus_config_t other_pins = shared_bus;
+    other_pins.pin_sclk = 14;
+
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_bus_init(&shared_bus));
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_bus_init(&write_only));
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_bus_init(&shared_bus));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, hal_spi_bus_init(&other_pins));
+
+    // The pins can only change once the last reference is gone
+    hal_spi_bus_free(1);
+    hal_spi_bus_free(1);
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, hal_spi_bus_init(&other_pins));
+    hal_spi_bus_free(1);
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_bus_init(&other_pins));
+}
+
+TEST_CASE("spi arbiter serves the highest priority waiter first", "[hal]")
+{
+    hal_spi_arbiter_t arb = { 0 };
+    struct hal_spi_client rfid = { 0 }, lcd = { 0 }, log = { 0 };
+    hal_spi_arbiter_add(&arb, &rfid, &(hal_spi_client_config_t) { .host = 1, .name = "rfid", .priority = 1 });
+    hal_spi_arbiter_add(&arb, &lcd, &(hal_spi_client_config_t) { .host = 1, .name = "lcd", .priority = 2 });
+    hal_spi_arbiter_add(&arb, &log, &(hal_spi_client_config_t) { .host = 1, .name = "log", .priority = 1 });
+    hal_spi_arbiter_clear(&arb, 0);
+
+    TEST_ASSERT_TRUE(hal_spi_arbiter_request(&arb, &rfid, 0));
+    TEST_ASSERT_FALSE(hal_spi_arbiter_request(&arb, &log, 10));
+    TEST_ASSERT_FALSE(hal_spi_arbiter_request(&arb, &lcd, 20));
+
+    // The display frame overtakes the earlier, lower priority waiter
+    TEST_ASSERT_EQUAL_PTR(&lcd, hal_spi_arbiter_release(&arb, &rfid, 50));
+    TEST_ASSERT_FALSE(hal_spi_arbiter_request(&arb, &rfid, 60));
+    // Equal priorities go in wait order
+    TEST_ASSERT_EQUAL_PTR(&log, hal_spi_arbiter_release(&arb, &lcd, 150));
+    TEST_ASSERT_EQUAL_PTR(&rfid, hal_spi_arbiter_release(&arb, &log, 160));
+    TEST_ASSERT_NULL(hal_spi_arbiter_release(&arb, &rfid, 170));
+    TEST_ASSERT_TRUE(hal_spi_arbiter_request(&arb, &lcd, 200));
+
+    hal_spi_client_stats_t stats[4];
+    int64_t window_us;
+    TEST_ASSERT_EQUAL(3, hal_spi_arbiter_stats(&arb, stats, 4, 300, &window_us));
+    TEST_ASSERT_EQUAL(300, window_us);
+
+    TEST_ASSERT_EQUAL_STRING("rfid", stats[0].name);
+    TEST_ASSERT_EQUAL_UINT32(2, stats[0].holds);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[0].contended);
+    TEST_ASSERT_EQUAL_UINT32(60, (uint32_t)stats[0].busy_us);
+    TEST_ASSERT_EQUAL_UINT32(100, (uint32_t)stats[0].wait_us);
+
+    TEST_ASSERT_EQUAL_UINT32(2, stats[1].holds);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[1].contended);
+    TEST_ASSERT_EQUAL_UINT32(100, (uint32_t)stats[1].busy_us); 		// The hold in progress is not counted yet
+    TEST_ASSERT_EQUAL_UINT32(30, stats[1].max_wait_us);
+
+    TEST_ASSERT_EQUAL_UINT32(1, stats[2].holds);
+    TEST_ASSERT_EQUAL_UINT32(10, (uint32_t)stats[2].busy_us);
+    TEST_ASSERT_EQUAL_UINT32(140, stats[2].max_wait_us);
+
+    // A client can only leave while it neither holds nor waits
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_STATE, hal_spi_arbiter_remove(&arb, &lcd));
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_arbiter_remove(&arb, &rfid));
+    TEST_ASSERT_EQUAL(2, hal_spi_arbiter_stats(&arb, stats, 4, 300, NULL));
+    TEST_ASSERT_EQUAL_STRING("lcd", stats[0].name);
+}
+
+TEST_CASE("lcd holds the shared bus for each flush", "[hal]")
+{
+    lcd_nokia5110_config_t config = {
+        .pin_sclk = 18,
+        .pin_din = 23,
+        .pin_dc = 17,
+        .pin_cs = 2,
+        .pin_rst = 21,
+        .spi_host = 1,
+        .bus_priority = 2,
+        .contrast = 0x3F,
+    };
+    lcd_nokia5110_t lcd = NULL;
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_bus_init(&shared_bus));
+    TEST_ASSERT_EQUAL(ESP_OK, lcd_nokia5110_init(&config, &lcd));
+
+    hal_spi_client_t rfid;
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_add_client(&(hal_spi_client_config_t) { .host = 1, .name = "rc522", .priority = 1 }, &rfid));
+    hal_spi_clear_client_stats(1);
+
+    lcd_nokia5110_set_cursor(lcd, 0, 0);
+    lcd_nokia5110_write_string(lcd, "Hi");
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_acquire(rfid));
+    hal_mock_time_advance_us(40);
+    hal_spi_release(rfid);
+
+    hal_spi_client_stats_t stats[HAL_SPI_MAX_CLIENTS];
+    TEST_ASSERT_EQUAL(2, hal_spi_get_client_stats(1, stats, HAL_SPI_MAX_CLIENTS, NULL));
+    TEST_ASSERT_EQUAL_STRING("lcd", stats[0].name);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[0].holds);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[1].holds);
+    TEST_ASSERT_EQUAL_UINT32(40, (uint32_t)stats[1].busy_us);
+
+    // The display leaves the bus, and its client, on deinit
+    lcd_nokia5110_deinit(lcd);
+    TEST_ASSERT_EQUAL(1, hal_spi_get_client_stats(1, stats, HAL_SPI_MAX_CLIENTS, NULL));
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_remove_client(rfid));
+    hal_spi_bus_free(1);
+}
+
+#if CONFIG_EBIKE_HAL_SPI_PROFILE
+
+TEST_CASE("spi profiler counts transactions, bytes and time per device", "[hal]")
+{
+    hal_spi_dev_t lcd, aux;
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_add_device(&(hal_spi_dev_config_t) {
+        .name = "lcd", .host = 1, .pin_cs = 2, .pin_dc = 17, .clock_hz = 4000000 }, &lcd));
+    TEST_ASSERT_EQUAL(ESP_OK, hal_spi_add_device(&(hal_spi_dev_config_t) {
+        .name = "aux", .host = 1, .pin_cs = 5, .clock_hz = 1000000 }, &aux));
+
+    static const uint8_t frame[100];
+    hal_spi_queue(lcd, frame, 2, 0); 					// 4 us at 4 MHz
+    hal_spi_queue(lcd, frame, 100, 1); 					// 200 us
+    hal_spi_write(aux, frame, 3); 					// 24 us at 1 MHz, polling
+    hal_mock_time_advance_us(1000);
+
+    hal_spi_prof_stats_t stats[HAL_SPI_PROF_MAX];
+    int64_t window_us;
+    TEST_ASSERT_EQUAL(2, hal_spi_prof_get_stats(stats, HAL_SPI_PROF_MAX, &window_us));
+    TEST_ASSERT_EQUAL(1000, window_us);
+
+    TEST_ASSERT_EQUAL_STRING("lcd", stats[0].name);
+    TEST_ASSERT_EQUAL_UINT32(2, stats[0].transactions);
+    TEST_ASSERT_EQUAL_UINT32(0, stats[0].polling);
+    TEST_ASSERT_EQUAL_UINT32(102, (uint32_t)stats[0].bytes);
+    TEST_ASSERT_EQUAL_UINT32(204, (uint32_t)stats[0].busy_us);
+    TEST_ASSERT_EQUAL_UINT32(200, stats[0].max_us);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[0].hist[2]); 			// [4, 8) us
+    TEST_ASSERT_EQUAL_UINT32(1, stats[0].hist[7]); 			// [128, 256) us
+
+    TEST_ASSERT_EQUAL_STRING("aux", stats[1].name);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[1].polling);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[1].hist[4]); 			// [16, 32) us
+
+    // Sub-microsecond and very long transactions land in the end buckets
+    hal_spi_prof_clear();
+    hal_spi_prof_t *prof = hal_spi_prof_from_id(2);
+    hal_spi_prof_record(prof, 1, 0, true);
+    hal_spi_prof_record(prof, 1, 1, true);
+    hal_spi_prof_record(prof, 1, 50000, true);
+    TEST_ASSERT_EQUAL(2, hal_spi_prof_get_stats(stats, HAL_SPI_PROF_MAX, &window_us));
+    TEST_ASSERT_EQUAL(0, window_us);
+    TEST_ASSERT_EQUAL_UINT32(0, stats[0].transactions);
+    TEST_ASSERT_EQUAL_STRING("aux", stats[1].name);
+    TEST_ASSERT_EQUAL_UINT32(2, stats[1].hist[0]);
+    TEST_ASSERT_EQUAL_UINT32(1, stats[1].hist[HAL_SPI_PROF_BUCKETS - 1]);
+}
+
+#endif
@@ -0,0 +1,484 @@
+#include <string.h>
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "lcd_nokia5110.h"
+#include "font_5x7.h"
+#include "host_test.h"
+
+#define LCD_DC_PIN           17
+
+static lcd_nokia5110_t lcd_open(lcd_nokia5110_emu_t *model) {
+    lcd_nokia5110_config_t config = {
+        .pin_sclk = 18,
+        .pin_din = 23,
+        .pin_dc = LCD_DC_PIN,
+        .pin_cs = 2,
+        .pin_rst = 21,
+        .spi_host = 1,
+        .contrast = 0x3F,
+    };
+    lcd_nokia5110_t lcd = NULL;
+    lcd_nokia5110_emu_attach(model, LCD_DC_PIN);
+    TEST_ASSERT_EQUAL(ESP_OK, lcd_nokia5110_init(&config, &lcd));
+    lcd_nokia5110_emu_clear_counts(model);
+    return lcd;
+}
+
+static void lcd_close(lcd_nokia5110_t lcd) {
+    lcd_nokia5110_deinit(lcd);
+    lcd_nokia5110_emu_detach();
+}
+
+TEST_CASE("lcd flush sends only the dirty span", "[lcd]")
+{
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    lcd_nokia5110_set_cursor(lcd, 12, 2);
+    lcd_nokia5110_write_char(lcd, 'A');
+    lcd_nokia5110_update(lcd);
+
+    // One addressed burst with the glyph; the blank spacer did not change
+    TEST_ASSERT_EQUAL_UINT32(1, model.cmd_transactions);
+    TEST_ASSERT_EQUAL_UINT32(1, model.data_transactions);
+    TEST_ASSERT_EQUAL_UINT32(5, model.data_bytes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['A' - 32], &model.ram[2][12], 5);
+
+    // Same glyph again is not dirty
+    lcd_nokia5110_emu_clear_counts(&model);
+    lcd_nokia5110_set_cursor(lcd, 12, 2);
+    lcd_nokia5110_write_char(lcd, 'A');
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(0, model.cmd_transactions + model.data_transactions);
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd merges close spans and wraps across banks", "[lcd]")
+{
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    // End of bank 0 and start of bank 1 are adjacent in display RAM
+    lcd_nokia5110_set_cursor(lcd, 78, 0);
+    lcd_nokia5110_write_char(lcd, '#');
+    lcd_nokia5110_set_cursor(lcd, 0, 1);
+    lcd_nokia5110_write_char(lcd, '#');
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(1, model.data_transactions);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['#' - 32], &model.ram[0][78], 5);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['#' - 32], &model.ram[1][0], 5);
+
+    // Far apart: two bursts, nothing in between is resent
+    lcd_nokia5110_emu_clear_counts(&model);
+    lcd_nokia5110_set_cursor(lcd, 0, 3);
+    lcd_nokia5110_write_char(lcd, 'x');
+    lcd_nokia5110_set_cursor(lcd, 60, 5);
+    lcd_nokia5110_write_char(lcd, 'y');
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(2, model.data_transactions);
+    TEST_ASSERT_LESS_OR_EQUAL(10, model.data_bytes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['x' - 32], &model.ram[3][0], 5);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['y' - 32], &model.ram[5][60], 5);
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd invalidate resends the whole frame", "[lcd]")
+{
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    lcd_nokia5110_set_cursor(lcd, 0, 0);
+    lcd_nokia5110_write_string(lcd, "Hello");
+    lcd_nokia5110_update(lcd);
+    memset(model.ram, 0, sizeof(model.ram));
+    lcd_nokia5110_emu_clear_counts(&model);
+
+    lcd_nokia5110_invalidate(lcd);
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(1, model.data_transactions);
+    TEST_ASSERT_EQUAL_UINT32(LCD_NOKIA5110_EMU_BANKS * LCD_NOKIA5110_EMU_WIDTH, model.data_bytes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['H' - 32], &model.ram[0][0], 5);
+    lcd_close(lcd);
+}
+
+// Reference image drawn pixel by pixel, packed like the display RAM
+typedef struct {
+    bool px[LCD_NOKIA5110_EMU_BANKS * 8][LCD_NOKIA5110_EMU_WIDTH];
+} ref_image_t;
+
+static void ref_fill(ref_image_t *ref, int x0, int y0, int x1, int y1, bool on) {
+    for (int y = y0; y <= y1; y++) {
+        for (int x = x0; x <= x1; x++) {
+            if (x < LCD_NOKIA5110_EMU_WIDTH && y < LCD_NOKIA5110_EMU_BANKS * 8) ref->px[y][x] = on;
+        }
+    }
+}
+
+static void assert_ref(const ref_image_t *ref, const lcd_nokia5110_emu_t *model) {
+    uint8_t expected[LCD_NOKIA5110_EMU_BANKS][LCD_NOKIA5110_EMU_WIDTH] = { 0 };
+    for (int y = 0; y < LCD_NOKIA5110_EMU_BANKS * 8; y++) {
+        for (int x = 0; x < LCD_NOKIA5110_EMU_WIDTH; x++) {
+            if (ref->px[y][x]) expected[y / 8][x] |= 1 << (y & 7);
+        }
+    }
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(expected, model->ram, sizeof(expected));
+}
+
+TEST_CASE("lcd lines and pixels match the golden image", "[lcd]")
+{
+    static const char *const golden[] = {
+        "#.........",
+        ".#....#...",
+        "..#...#...",
+        "...#..#...",
+        "....#.#...",
+        "......#...",
+        "......#...",
+        "......#...",
+        "......#...",
+        "######....",
+        "..........",
+        "#.#.......",
+    };
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    lcd_nokia5110_draw_line(lcd, 4, 4, 0, 0, true); 			// Diagonal, reversed
+    lcd_nokia5110_draw_line(lcd, 6, 1, 6, 8, true); 			// Vertical across a bank edge
+    lcd_nokia5110_draw_line(lcd, 5, 9, 0, 9, true); 			// Horizontal, reversed
+    lcd_nokia5110_draw_pixel(lcd, 0, 11, true);
+    lcd_nokia5110_draw_pixel(lcd, 2, 11, true);
+    lcd_nokia5110_draw_pixel(lcd, 1, 11, false);
+    lcd_nokia5110_draw_pixel(lcd, 200, 200, true); 			// Clipped
+    lcd_nokia5110_update(lcd);
+
+    host_test_assert_frame(&model, "lcd_lines", golden, sizeof(golden) / sizeof(golden[0]));
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd rectangles match the per-pixel reference", "[lcd]")
+{
+    lcd_nokia5110_emu_t model;
+    ref_image_t ref = { 0 };
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    // Filled across three banks, then a hole cut out of it
+    lcd_nokia5110_draw_rect(lcd, 3, 5, 20, 14, true, true);
+    ref_fill(&ref, 3, 5, 22, 18, true);
+    lcd_nokia5110_draw_rect(lcd, 6, 7, 4, 9, true, false);
+    ref_fill(&ref, 6, 7, 9, 15, false);
+
+    // Outline
+    lcd_nokia5110_draw_rect(lcd, 40, 20, 10, 6, false, true);
+    ref_fill(&ref, 40, 20, 49, 20, true);
+    ref_fill(&ref, 40, 25, 49, 25, true);
+    ref_fill(&ref, 40, 20, 40, 25, true);
+    ref_fill(&ref, 49, 20, 49, 25, true);
+
+    // Clipped at the bottom-right corner
+    lcd_nokia5110_draw_rect(lcd, 80, 44, 10, 10, true, true);
+    ref_fill(&ref, 80, 44, 83, 47, true);
+
+    lcd_nokia5110_update(lcd);
+    assert_ref(&ref, &model);
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd bitmap replaces its box at any y offset", "[lcd]")
+{
+    // 5 x 11 arrow-ish pattern, two banks
+    static const uint8_t bitmap[] = {
+        0x81, 0xC3, 0xFF, 0xC3, 0x81,
+        0x05, 0x02, 0x07, 0x02, 0x05,
+    };
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    for (int y = 0; y < 8; y++) {
+        ref_image_t ref = { 0 };
+        lcd_nokia5110_clear(lcd);
+
+        // Background that must survive outside the box and vanish inside
+        lcd_nokia5110_draw_rect(lcd, 0, 0, 84, 48, true, true);
+        ref_fill(&ref, 0, 0, 83, 47, true);
+
+        lcd_nokia5110_draw_bitmap(lcd, 30, 13 + y, bitmap, 5, 11);
+        for (int col = 0; col < 5; col++) {
+            for (int row = 0; row < 11; row++) {
+                ref.px[13 + y + row][30 + col] = (bitmap[(row / 8) * 5 + col] >> (row & 7)) & 1;
+            }
+        }
+
+        lcd_nokia5110_update(lcd);
+        assert_ref(&ref, &model);
+    }
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd invert switches inverse video without touching RAM", "[lcd]")
+{
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    lcd_nokia5110_invert(lcd, true);
+    TEST_ASSERT_EQUAL_UINT32(1, model.cmd_transactions);
+    TEST_ASSERT_EQUAL_UINT32(0, model.data_transactions);
+    TEST_ASSERT_EQUAL_HEX8(0x0D, model.last_cmd);
+
+    lcd_nokia5110_invert(lcd, false);
+    TEST_ASSERT_EQUAL_HEX8(0x0C, model.last_cmd);
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd fixed-point numbers match the formatted text", "[lcd]")
+{
+    static const struct {
+        int32_t value;
+        uint8_t decimals;
+        uint8_t width;
+        uint8_t flags;
+        const char *text;
+    } cases[] = {
+        { 365, 1, 0, 0, "36.5" },
+        { 365, 1, 6, 0, "  36.5" },
+        { 5, 1, 5, 0, "  0.5" },
+        { 0, 0, 3, 0, "  0" },
+        { 7, 2, 0, 0, "0.07" },
+        { -42, 1, 6, 0, "  -4.2" },
+        { 42, 0, 5, LCD_NOKIA5110_NUM_ZERO_PAD, "00042" },
+        { -42, 0, 5, LCD_NOKIA5110_NUM_ZERO_PAD, "-0042" },
+        { 12345, 1, 4, 0, "----" },
+        { INT32_MIN, 0, 0, 0, "-2147483648" },
+    };
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    for (size_t i = 0; i < sizeof(cases) / sizeof(cases[0]); i++) {
+        uint8_t expected[LCD_NOKIA5110_EMU_WIDTH] = { 0 };
+        const char *str = cases[i].text;
+        for (int x = 0; *str; str++, x += 6) {
+            memcpy(&expected[x], font_5x7[*str - 32], 5);
+        }
+
+        lcd_nokia5110_clear(lcd);
+        lcd_nokia5110_set_cursor(lcd, 0, 2);
+        lcd_nokia5110_write_fixed(lcd, cases[i].value, cases[i].decimals, cases[i].width, cases[i].flags);
+        lcd_nokia5110_update(lcd);
+        TEST_ASSERT_EQUAL_UINT8_ARRAY_MESSAGE(expected, model.ram[2], LCD_NOKIA5110_EMU_WIDTH, cases[i].text);
+    }
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd large digits match the scaled 5x7 font", "[lcd]")
+{
+    static const struct {
+        const font_digits_t *font;
+        int scale;
+    } fonts[] = {
+        { &font_digits_1x, 1 },
+        { &font_digits_2x, 2 },
+        { &font_digits_3x, 3 },
+    };
+    static const char text[] = "-4.7";
+    static ref_image_t ref;
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    for (size_t f = 0; f < sizeof(fonts) / sizeof(fonts[0]); f++) {
+        int n = fonts[f].scale;
+        memset(&ref, 0, sizeof(ref));
+        for (int c = 0; text[c]; c++) {
+            const uint8_t *glyph = font_5x7[text[c] - 32];
+            for (int x = 0; x < 5; x++) {
+                for (int y = 0; y < 8; y++) {
+                    if (!((glyph[x] >> y) & 1)) continue;
+                    int px = (c * 6 + x) * n;
+                    ref_fill(&ref, px, 8 + y * n, px + n - 1, 8 + y * n + n - 1, true);
+                }
+            }
+        }
+
+        lcd_nokia5110_clear(lcd);
+        lcd_nokia5110_set_cursor(lcd, 0, 1);
+        lcd_nokia5110_write_fixed_font(lcd, fonts[f].font, -47, 1, 0, 0);
+        lcd_nokia5110_update(lcd);
+        assert_ref(&ref, &model);
+    }
+    lcd_close(lcd);
+}
+
+TEST_CASE("lcd 7-segment digits match the golden image", "[lcd]")
+{
+    static const char *const golden[] = {
+        "..............######............................",
+        "..............######............................",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "..######......######............................",
+        "..######......######............................",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "............##......##......................##..",
+        "..............######........##..................",
+        "..............######........##..................",
+        "................................................",
+    };
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+
+    lcd_nokia5110_write_fixed_font(lcd, &font_digits_7seg, -81, 1, 0, 0);
+    lcd_nokia5110_update(lcd);
+
+    host_test_assert_frame(&model, "lcd_7seg", golden, sizeof(golden) / sizeof(golden[0]));
+    lcd_close(lcd);
+}
+
+// SSD1306 on the I2C bus, through the same framebuffer and drawing code
+
+#define OLED_ADDR            0x3D
+
+static lcd_nokia5110_t oled_open(lcd_nokia5110_ssd1306_emu_t *oled, uint8_t height) {
+    lcd_nokia5110_config_t config = {
+        .panel = LCD_NOKIA5110_PANEL_SSD1306,
+        .i2c_port = 0,
+        .pin_sda = 23,
+        .pin_scl = 18,
+        .i2c_addr = OLED_ADDR,
+        .height = height,
+        .contrast = 0x3F,
+    };
+    lcd_nokia5110_t lcd = NULL;
+    lcd_nokia5110_ssd1306_emu_attach(oled);
+    TEST_ASSERT_EQUAL(ESP_OK, lcd_nokia5110_init(&config, &lcd));
+    lcd_nokia5110_ssd1306_emu_clear_counts(oled);
+    return lcd;
+}
+
+static void oled_close(lcd_nokia5110_t lcd) {
+    lcd_nokia5110_deinit(lcd);
+    lcd_nokia5110_ssd1306_emu_detach();
+}
+
+// Text, a frame and a bitmap across a bank boundary
+static void draw_sample(lcd_nokia5110_t lcd) {
+    static const uint8_t arrow[5] = { 0x08, 0x1C, 0x3E, 0x7F, 0x08 };
+    lcd_nokia5110_set_cursor(lcd, 0, 0);
+    lcd_nokia5110_write_string(lcd, "Batt:");
+    lcd_nokia5110_set_cursor(lcd, 0, 1);
+    lcd_nokia5110_write_fixed_font(lcd, &font_digits_2x, 274, 1, 4, 0);
+    lcd_nokia5110_draw_rect(lcd, 2, 30, 60, 12, false, true);
+    lcd_nokia5110_draw_bitmap(lcd, 70, 21, arrow, 5, 7);
+    lcd_nokia5110_update(lcd);
+}
+
+TEST_CASE("ssd1306 init clears the panel in one window", "[lcd]")
+{
+    lcd_nokia5110_ssd1306_emu_t oled;
+    lcd_nokia5110_ssd1306_emu_attach(&oled);
+    memset(oled.ram, 0xA5, sizeof(oled.ram));
+
+    lcd_nokia5110_config_t config = {
+        .panel = LCD_NOKIA5110_PANEL_SSD1306,
+        .i2c_addr = OLED_ADDR,
+        .contrast = 0x3F,
+    };
+    lcd_nokia5110_t lcd = NULL;
+    TEST_ASSERT_EQUAL(ESP_OK, lcd_nokia5110_init(&config, &lcd));
+
+    // Init commands and the window address share one command transaction
+    TEST_ASSERT_EQUAL_UINT32(1, oled.cmd_transactions);
+    TEST_ASSERT_EQUAL_UINT32(1, oled.data_transactions);
+    TEST_ASSERT_EQUAL_UINT32(1 + sizeof(oled.ram), oled.data_bytes);
+    TEST_ASSERT_TRUE(oled.on);
+    TEST_ASSERT_EQUAL_UINT8(64, oled.height);
+    TEST_ASSERT_EQUAL_HEX8(0x7E, oled.contrast);
+    for (int page = 0; page < LCD_NOKIA5110_SSD1306_EMU_PAGES; page++) {
+        TEST_ASSERT_EACH_EQUAL_HEX8(0x00, oled.ram[page], LCD_NOKIA5110_SSD1306_EMU_WIDTH);
+    }
+
+    uint8_t width, height;
+    lcd_nokia5110_get_size(lcd, &width, &height);
+    TEST_ASSERT_EQUAL_UINT8(128, width);
+    TEST_ASSERT_EQUAL_UINT8(64, height);
+    oled_close(lcd);
+}
+
+TEST_CASE("ssd1306 shows the same pixels as the pcd8544", "[lcd]")
+{
+    lcd_nokia5110_emu_t model;
+    lcd_nokia5110_t lcd = lcd_open(&model);
+    draw_sample(lcd);
+    lcd_close(lcd);
+
+    lcd_nokia5110_ssd1306_emu_t oled;
+    lcd = oled_open(&oled, 64);
+    draw_sample(lcd);
+
+    for (int y = 0; y < LCD_NOKIA5110_SSD1306_EMU_PAGES * 8; y++) {
+        for (int x = 0; x < LCD_NOKIA5110_SSD1306_EMU_WIDTH; x++) {
+            TEST_ASSERT_EQUAL(lcd_nokia5110_emu_pixel(&model, x, y), lcd_nokia5110_ssd1306_emu_pixel(&oled, x, y));
+        }
+    }
+    oled_close(lcd);
+}
+
+TEST_CASE("ssd1306 batches dirty pages into address windows", "[lcd]")
+{
+    lcd_nokia5110_ssd1306_emu_t oled;
+    lcd_nokia5110_t lcd = oled_open(&oled, 64);
+
+    // Same columns on adjacent pages: one 2-page window
+    lcd_nokia5110_set_cursor(lcd, 40, 2);
+    lcd_nokia5110_write_char(lcd, 'A');
+    lcd_nokia5110_set_cursor(lcd, 40, 3);
+    lcd_nokia5110_write_char(lcd, 'B');
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(1, oled.cmd_transactions);
+    TEST_ASSERT_EQUAL_UINT32(1, oled.data_transactions);
+    TEST_ASSERT_EQUAL_UINT32(1 + 2 * 5, oled.data_bytes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['A' - 32], &oled.ram[2][40], 5);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['B' - 32], &oled.ram[3][40], 5);
+
+    // Far apart: two windows, nothing in between is resent
+    lcd_nokia5110_ssd1306_emu_clear_counts(&oled);
+    lcd_nokia5110_set_cursor(lcd, 0, 0);
+    lcd_nokia5110_write_char(lcd, 'x');
+    lcd_nokia5110_set_cursor(lcd, 120, 7);
+    lcd_nokia5110_write_char(lcd, 'y');
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(2, oled.data_transactions);
+    TEST_ASSERT_EQUAL_UINT32(2 * (1 + 5), oled.data_bytes);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['x' - 32], &oled.ram[0][0], 5);
+    TEST_ASSERT_EQUAL_UINT8_ARRAY(font_5x7['y' - 32], &oled.ram[7][120], 5);
+
+    // Unchanged frame: no bus traffic
+    lcd_nokia5110_ssd1306_emu_clear_counts(&oled);
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(0, oled.cmd_transactions + oled.data_transactions);
+    oled_close(lcd);
+}
+
+TEST_CASE("ssd1306 128x32 clips drawing to four pages", "[lcd]")
+{
+    lcd_nokia5110_ssd1306_emu_t oled;
+    lcd_nokia5110_t lcd = oled_open(&oled, 32);
+    TEST_ASSERT_EQUAL_UINT8(32, oled.height);
+
+    lcd_nokia5110_draw_rect(lcd, 0, 0, 128, 64, true, true);
+    lcd_nokia5110_update(lcd);
+    TEST_ASSERT_EQUAL_UINT32(1 + 4 * 128, oled.data_bytes);
+    TEST_ASSERT_TRUE(lcd_nokia5110_ssd1306_emu_pixel(&oled, 127, 31));
+    TEST_ASSERT_EACH_EQUAL_HEX8(0x00, oled.ram[4], LCD_NOKIA5110_SSD1306_EMU_WIDTH);
+
+    // Inverse video in the controller, no data resent
+    lcd_nokia5110_ssd1306_emu_clear_counts(&oled);
+    lcd_nokia5110_invert(lcd, true);
+    TEST_ASSERT_EQUAL_UINT32(1, oled.cmd_transactions);
+    TEST_ASSERT_EQUAL_UINT32(0, oled.data_transactions);
+    TEST_ASSERT_FALSE(lcd_nokia5110_ssd1306_emu_pixel(&oled, 0, 0));
+    oled_close(lcd);
+}
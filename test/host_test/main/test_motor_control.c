@@ -0,0 +1,148 @@
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "motor_control.h"
+#include "host_test.h"
+
+TEST_CASE("motor output is zero when idle", "[motor]")
+{
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("accelerator overrides assist", "[motor]")
+{
+    hal_mock_ain_set(ACCELERATOR_ADC, 4095);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(255, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    hal_mock_ain_set(ACCELERATOR_ADC, 2048);
+    motor_control_tick();
+    TEST_ASSERT_UINT8_WITHIN(1, 127, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    // Below the 10% dead band the throttle is ignored
+    hal_mock_ain_set(ACCELERATOR_ADC, 300);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("assist level follows the potentiometer", "[motor]")
+{
+    hal_mock_ain_set(POTENTIOMETER_ADC, 0);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(30, motor_control_assist_level());
+
+    hal_mock_ain_set(POTENTIOMETER_ADC, 4095);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(80, motor_control_assist_level());
+}
+
+TEST_CASE("pedaling engages PID assist", "[motor]")
+{
+    hal_mock_ain_set(POTENTIOMETER_ADC, 4095);
+    host_test_pulse(PEDAL_HALL_PIN);
+    motor_control_tick();
+
+    // Standing start: the full 240 RPM error saturates the output
+    TEST_ASSERT_EQUAL_UINT8(255, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    // No pedal edge since the last tick: assist drops out
+    hal_mock_time_advance_us(PID_UPDATE_MS * 1000);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("pedal timeout cuts assist", "[motor]")
+{
+    hal_mock_ain_set(POTENTIOMETER_ADC, 4095);
+    host_test_pulse(PEDAL_HALL_PIN);
+    hal_mock_time_advance_us((PEDAL_TIMEOUT_MS + 1) * 1000);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("speed from hall period", "[motor]")
+{
+    // 10 ms between edges: 100 Hz / 6 edges per rev = 1000 RPM, and
+    // 1000 turns of 2.1 m a minute is 126 km/h
+    host_test_pulse(HALL1_PIN);
+    hal_mock_time_advance_us(10000);
+    host_test_pulse(HALL2_PIN);
+
+    TEST_ASSERT_FLOAT_WITHIN(0.5f, 1000.0f, calculate_motor_speed());
+    TEST_ASSERT_FLOAT_WITHIN(0.05f, 126.0f, motor_control_speed_kmh());
+
+    // A period is only consumed once
+    TEST_ASSERT_EQUAL_FLOAT(0.0f, calculate_motor_speed());
+}
+
+TEST_CASE("motor output is clamped", "[motor]")
+{
+    set_motor_output(-0.5f);
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+    set_motor_output(2.0f);
+    TEST_ASSERT_EQUAL_UINT8(255, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("profile sets the assist range and disables the accelerator", "[motor]")
+{
+    motor_profile_t profile = motor_profile_default;
+    profile.assist_min = 10;
+    profile.assist_max = 50;
+    profile.throttle = false;
+    motor_control_set_profile(&profile);
+
+    hal_mock_ain_set(POTENTIOMETER_ADC, 4095);
+    hal_mock_ain_set(ACCELERATOR_ADC, 4095);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(50, motor_control_assist_level());
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    hal_mock_ain_set(POTENTIOMETER_ADC, 0);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(10, motor_control_assist_level());
+
+    // NULL goes back to the defaults
+    motor_control_set_profile(NULL);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(30, motor_control_assist_level());
+    TEST_ASSERT_EQUAL_UINT8(255, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("profile speed limit cuts the motor", "[motor]")
+{
+    motor_profile_t profile = motor_profile_default;
+    profile.speed_limit_kmh = 25;
+    motor_control_set_profile(&profile);
+    hal_mock_ain_set(ACCELERATOR_ADC, 4095);
+
+    // 60 ms between hall edges is 21 km/h, under the limit
+    host_test_pulse(HALL1_PIN);
+    hal_mock_time_advance_us(60000);
+    host_test_pulse(HALL2_PIN);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(255, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    // 50 ms is 25.2 km/h
+    hal_mock_time_advance_us(50000);
+    host_test_pulse(HALL3_PIN);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("profile gains drive the PID", "[motor]")
+{
+    // A tenth of the default gain leaves the standing start unsaturated
+    motor_profile_t profile = motor_profile_default;
+    profile.kp = 0.1;
+    profile.ki = 0;
+    profile.kd = 0;
+    motor_control_set_profile(&profile);
+
+    hal_mock_ain_set(POTENTIOMETER_ADC, 4095);
+    host_test_pulse(PEDAL_HALL_PIN);
+    motor_control_tick();
+
+    // 0.1 * 240 RPM / 300 RPM = 0.08 of full scale
+    TEST_ASSERT_UINT8_WITHIN(1, 20, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
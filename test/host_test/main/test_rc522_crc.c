@@ -0,0 +1,65 @@
+#include <string.h>
+#include "unity.h"
+#include "rc522_crc.h"
+
+// Bit-serial CRC_A straight from ISO/IEC 14443-3 Annex B
+static uint16_t crc_a_bitwise(const uint8_t *data, size_t length) {
+    uint16_t crc = RC522_CRC_A_PRESET;
+    for (size_t i = 0; i < length; i++) {
+        crc ^= data[i];
+        for (int bit = 0; bit < 8; bit++) {
+            crc = (crc & 1) ? (crc >> 1) ^ 0x8408 : crc >> 1;
+        }
+    }
+    return crc;
+}
+
+TEST_CASE("rc522 crc_a matches the ISO 14443-3 and command vectors", "[rc522]")
+{
+    // The LSB goes out first: HLTA is sent as 50 00 57 CD
+    static const struct {
+        uint8_t data[2];
+        uint16_t crc;
+    } vectors[] = {
+        { { 0x00, 0x00 }, 0x1EA0 },	// ISO/IEC 14443-3 Annex B
+        { { 0x12, 0x34 }, 0xCF26 },	// ISO/IEC 14443-3 Annex B
+        { { 0x50, 0x00 }, 0xCD57 },	// HLTA
+        { { 0x30, 0x00 }, 0xA802 },	// READ page 0
+        { { 0xE0, 0x50 }, 0xA5BC },	// RATS
+    };
+
+    for (size_t i = 0; i < sizeof(vectors) / sizeof(vectors[0]); i++) {
+        TEST_ASSERT_EQUAL_HEX16(vectors[i].crc, rc522_crc_a(vectors[i].data, 2));
+    }
+    TEST_ASSERT_EQUAL_HEX16(RC522_CRC_A_PRESET, rc522_crc_a(NULL, 0));
+}
+
+TEST_CASE("rc522 crc_a table matches the bit-serial CRC", "[rc522]")
+{
+    uint8_t frame[18];
+    uint32_t seed = 1;
+
+    for (int n = 0; n < 1000; n++) {
+        size_t length = n % (sizeof(frame) - 1) + 1;
+        for (size_t i = 0; i < length; i++) {
+            seed = seed * 1103515245 + 12345;
+            frame[i] = seed >> 16;
+        }
+        TEST_ASSERT_EQUAL_HEX16(crc_a_bitwise(frame, length), rc522_crc_a(frame, length));
+    }
+}
+
+TEST_CASE("rc522 crc_a continues across chunks and checks to zero", "[rc522]")
+{
+    uint8_t frame[18] = { 0xA0, 0x04 };	// WRITE block 4 with its data
+    for (int i = 2; i < 16; i++) frame[i] = i * 17;
+
+    uint16_t crc = rc522_crc_a(frame, 16);
+    uint16_t chunked = rc522_crc_a_update(rc522_crc_a(frame, 5), frame + 5, 11);
+    TEST_ASSERT_EQUAL_HEX16(crc, chunked);
+
+    // A received frame with its CRC appended LSB first leaves no residue
+    frame[16] = crc & 0xFF;
+    frame[17] = crc >> 8;
+    TEST_ASSERT_EQUAL_HEX16(0, rc522_crc_a(frame, 18));
+}
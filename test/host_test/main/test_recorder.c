@@ -0,0 +1,96 @@
+#include <string.h>
+#include "unity.h"
+#include "rec_format.h"
+
+static void roundtrip(const rec_event_t *in, size_t expect_len) {
+    uint8_t buf[REC_MAX_RECORD_LEN];
+    int64_t enc_last = 1000, dec_last = 1000;
+    rec_event_t out;
+
+    size_t len = rec_encode(in, &enc_last, buf);
+    TEST_ASSERT_EQUAL(expect_len, len);
+    TEST_ASSERT_EQUAL(len, rec_decode(buf, len, &dec_last, &out));
+    TEST_ASSERT_EQUAL(in->time_us, out.time_us);
+    TEST_ASSERT_EQUAL(enc_last, dec_last);
+    TEST_ASSERT_EQUAL(in->type, out.type);
+
+    switch (in->type) {
+        case REC_TICK:
+            TEST_ASSERT_EQUAL(in->tick.pot_raw, out.tick.pot_raw);
+            TEST_ASSERT_EQUAL(in->tick.accel_raw, out.tick.accel_raw);
+            TEST_ASSERT_EQUAL(in->tick.levels, out.tick.levels);
+            break;
+        case REC_EDGE:
+            TEST_ASSERT_EQUAL(in->edge.pin, out.edge.pin);
+            break;
+        case REC_RFID:
+            TEST_ASSERT_EQUAL(in->rfid.uid_len, out.rfid.uid_len);
+            TEST_ASSERT_EQUAL_MEMORY(in->rfid.uid, out.rfid.uid, in->rfid.uid_len);
+            break;
+        case REC_AUTH:
+            TEST_ASSERT_EQUAL(in->auth.result, out.auth.result);
+            break;
+        case REC_PROFILE:
+            TEST_ASSERT_EQUAL(in->profile.assist_min, out.profile.assist_min);
+            TEST_ASSERT_EQUAL(in->profile.assist_max, out.profile.assist_max);
+            TEST_ASSERT_EQUAL(in->profile.speed_limit_kmh, out.profile.speed_limit_kmh);
+            TEST_ASSERT_EQUAL(in->profile.throttle, out.profile.throttle);
+            TEST_ASSERT_EQUAL_MEMORY(&in->profile.kp, &out.profile.kp, sizeof(double));
+            TEST_ASSERT_EQUAL_MEMORY(&in->profile.ki, &out.profile.ki, sizeof(double));
+            TEST_ASSERT_EQUAL_MEMORY(&in->profile.kd, &out.profile.kd, sizeof(double));
+            break;
+        default:
+            TEST_ASSERT_EQUAL(in->gap.lost, out.gap.lost);
+            break;
+    }
+}
+
+TEST_CASE("record encoding round trips", "[recorder]")
+{
+    rec_event_t tick = { .type = REC_TICK, .time_us = 51000,
+                         .tick = { .pot_raw = 0xABC, .accel_raw = 0x123, .levels = 0x5 } };
+    roundtrip(&tick, 1 + 3 + 3); 			// 50 ms delta fits 3 varint bytes
+
+    rec_event_t edge = { .type = REC_EDGE, .time_us = 1400, .edge.pin = 27 };
+    roundtrip(&edge, 1 + 2);
+
+    rec_event_t rfid = { .type = REC_RFID, .time_us = 1000,
+                         .rfid = { .uid_len = 7, .uid = { 1, 2, 3, 4, 5, 6, 7 } } };
+    roundtrip(&rfid, 1 + 1 + 7);
+
+    rec_event_t auth = { .type = REC_AUTH, .time_us = 1200, .auth.result = 8 };
+    roundtrip(&auth, 1 + 2 + 1);
+
+    rec_event_t profile = { .type = REC_PROFILE, .time_us = 1300,
+                            .profile = { .assist_min = 10, .assist_max = 60, .speed_limit_kmh = 25,
+                                         .throttle = false, .kp = 0.7, .ki = 0.013, .kd = -0.1 } };
+    roundtrip(&profile, 1 + 2 + REC_PROFILE_LEN);
+
+    // Edge from the other core, timestamped just before the previous record
+    rec_event_t early = { .type = REC_EDGE, .time_us = 990, .edge.pin = 3 };
+    roundtrip(&early, 1 + 1);
+
+    rec_event_t gap = { .type = REC_GAP, .time_us = 1000, .gap.lost = 12 };
+    roundtrip(&gap, 1 + 1);
+}
+
+TEST_CASE("record decoding stops at end and rejects truncation", "[recorder]")
+{
+    uint8_t buf[REC_MAX_RECORD_LEN];
+    int64_t last = 0;
+    rec_event_t ev = { .type = REC_TICK, .time_us = 50000, .tick.pot_raw = 100 };
+    size_t len = rec_encode(&ev, &last, buf);
+
+    last = 0;
+    TEST_ASSERT_EQUAL(-1, rec_decode(buf, len - 1, &last, &ev));
+    TEST_ASSERT_EQUAL(-1, rec_decode(buf, 2, &last, &ev));
+
+    uint8_t end = REC_END_BYTE;
+    TEST_ASSERT_EQUAL(0, rec_decode(&end, 1, &last, &ev));
+    TEST_ASSERT_EQUAL(0, rec_decode(buf, 0, &last, &ev));
+
+    // GAP counts saturate below the end marker
+    rec_event_t gap = { .type = REC_GAP, .gap.lost = 200 };
+    rec_encode(&gap, &last, buf);
+    TEST_ASSERT_NOT_EQUAL(REC_END_BYTE, buf[0]);
+}
@@ -0,0 +1,192 @@
+#include <string.h>
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "motor_control.h"
+#include "turn_signals.h"
+#include "rec_format.h"
+#include "replay.h"
+#include "auth.h"
+#include "host_test.h"
+
+static uint8_t ride[64 * 1024];
+static uint8_t dac_log[4096];
+static size_t dac_count;
+
+// Synthetic ride: granted tag, then ticks every 50 ms with a slowly moving assist
+// knob, pedal strokes every 400 ms, hall edges speeding up, a right turn
+// with a car in the blind spot and a throttle burst.
+size_t host_test_make_ride(uint8_t *buf, size_t cap, int seconds) {
+    static const uint8_t uid[] = { 0x04, 0xA1, 0x5B, 0x22, 0x3C, 0x61, 0x80 };
+    int64_t last = 0;
+    size_t len = REC_MAGIC_LEN;
+    memcpy(buf, REC_MAGIC, REC_MAGIC_LEN);
+
+    rec_event_t tag = { .type = REC_RFID, .time_us = HOST_TEST_T0_US, .rfid.uid_len = sizeof(uid) };
+    memcpy(tag.rfid.uid, uid, sizeof(uid));
+    len += rec_encode(&tag, &last, &buf[len]);
+    rec_event_t auth = { .type = REC_AUTH, .time_us = HOST_TEST_T0_US + 2000, .auth.result = AUTH_GRANTED };
+    len += rec_encode(&auth, &last, &buf[len]);
+
+    int64_t hall_period = 40000;
+    int64_t next_hall = HOST_TEST_T0_US + 10000;
+    int64_t end = HOST_TEST_T0_US + (int64_t)seconds * 1000000;
+
+    for (int64_t t = HOST_TEST_T0_US + 50000; t < end && len + 4 * REC_MAX_RECORD_LEN < cap; t += 50000) {
+        while (next_hall < t) {
+            rec_event_t edge = { .type = REC_EDGE, .time_us = next_hall, .edge.pin = HALL1_PIN };
+            len += rec_encode(&edge, &last, &buf[len]);
+            if (hall_period > 8000) hall_period -= 50;
+            next_hall += hall_period;
+        }
+        if ((t / 50000) % 8 == 0) {
+            rec_event_t pedal = { .type = REC_EDGE, .time_us = t - 1000, .edge.pin = PEDAL_HALL_PIN };
+            len += rec_encode(&pedal, &last, &buf[len]);
+        }
+
+        int64_t s = (t - HOST_TEST_T0_US) / 1000000;
+        rec_event_t tick = {
+            .type = REC_TICK,
+            .time_us = t,
+            .tick = {
+                .pot_raw = (uint16_t)((t / 50000 * 7) % 4096),
+                .accel_raw = (s % 20 == 15) ? 3000 : 0,
+                .levels = (s % 20 == 5) ? (TURN_LEVEL_RIGHT | RCWL_LEVEL_RIGHT) : 0,
+            },
+        };
+        len += rec_encode(&tick, &last, &buf[len]);
+    }
+    return len;
+}
+
+static void log_dac(const rec_event_t *tick, uint8_t dac_value, void *ctx) {
+    if (dac_count < sizeof(dac_log)) dac_log[dac_count++] = dac_value;
+}
+
+TEST_CASE("replay is deterministic", "[replay]")
+{
+    size_t len = host_test_make_ride(ride, sizeof(ride), 30);
+    replay_result_t first, second;
+
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, len, NULL, NULL, &first));
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, len, NULL, NULL, &second));
+
+    TEST_ASSERT_EQUAL_UINT32(first.digest, second.digest);
+    TEST_ASSERT_EQUAL_UINT32(599, first.ticks);
+    TEST_ASSERT_EQUAL_UINT32(1, first.tags);
+    TEST_ASSERT_GREATER_THAN(0, first.frames);
+    TEST_ASSERT_EQUAL(0, first.lost);
+}
+
+TEST_CASE("replay matches driving the inputs directly", "[replay]")
+{
+    size_t len = host_test_make_ride(ride, sizeof(ride), 10);
+    replay_result_t result;
+    dac_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, len, log_dac, NULL, &result));
+
+    // Same stream, applied by hand to a fresh board
+    hal_mock_reset();
+    hal_mock_time_manual(true);
+    motor_control_reset();
+    turn_signals_reset();
+    turn_signals_init();
+    motor_control_init();
+
+    int64_t last = 0;
+    size_t pos = REC_MAGIC_LEN, ticks = 0;
+    rec_event_t ev;
+    int n;
+    while ((n = rec_decode(&ride[pos], len - pos, &last, &ev)) > 0) {
+        pos += n;
+        hal_mock_time_set_us(ev.time_us);
+        if (ev.type == REC_EDGE) {
+            host_test_pulse(ev.edge.pin);
+        } else if (ev.type == REC_TICK) {
+            hal_mock_ain_set(POTENTIOMETER_ADC, ev.tick.pot_raw);
+            hal_mock_ain_set(ACCELERATOR_ADC, ev.tick.accel_raw);
+            hal_mock_dio_set(TURN_SIGNAL_RIGHT, ev.tick.levels & TURN_LEVEL_RIGHT);
+            hal_mock_dio_set(RCWL_RIGHT_GPIO, ev.tick.levels & RCWL_LEVEL_RIGHT);
+            motor_control_tick();
+            TEST_ASSERT_EQUAL_UINT8(dac_log[ticks], hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+            ticks++;
+        }
+    }
+    TEST_ASSERT_EQUAL(result.ticks, ticks);
+}
+
+TEST_CASE("replay activates only on a granted tag", "[replay]")
+{
+    size_t len = host_test_make_ride(ride, sizeof(ride), 5);
+    replay_result_t granted, denied;
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, len, NULL, NULL, &granted));
+    TEST_ASSERT_GREATER_THAN(0, granted.frames);
+
+    // Same ride, but the recorded decision was a denial
+    int64_t last = 0;
+    size_t pos = REC_MAGIC_LEN;
+    rec_event_t ev;
+    int n;
+    while ((n = rec_decode(&ride[pos], len - pos, &last, &ev)) > 0 && ev.type != REC_AUTH) {
+        pos += n;
+    }
+    TEST_ASSERT_GREATER_THAN(0, n);
+    ride[pos + n - 1] = AUTH_DENIED;
+
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, len, NULL, NULL, &denied));
+    TEST_ASSERT_EQUAL_UINT32(1, denied.tags);
+    TEST_ASSERT_EQUAL_UINT32(0, denied.frames);
+    TEST_ASSERT_EQUAL(0, hal_mock_dio_get(SYSTEM_ACTIVE_LED));
+}
+
+// One second at full knob and throttle after a granted tag, with or
+// without the profile the device recorded for it
+static size_t make_throttle_ride(uint8_t *buf, const rec_profile_t *profile) {
+    int64_t last = 0;
+    size_t len = REC_MAGIC_LEN;
+    memcpy(buf, REC_MAGIC, REC_MAGIC_LEN);
+
+    rec_event_t tag = { .type = REC_RFID, .time_us = HOST_TEST_T0_US, .rfid = { .uid_len = 4, .uid = { 1, 2, 3, 4 } } };
+    len += rec_encode(&tag, &last, &buf[len]);
+    if (profile) {
+        rec_event_t ev = { .type = REC_PROFILE, .time_us = HOST_TEST_T0_US + 1000, .profile = *profile };
+        len += rec_encode(&ev, &last, &buf[len]);
+    }
+    rec_event_t auth = { .type = REC_AUTH, .time_us = HOST_TEST_T0_US + 2000, .auth.result = AUTH_GRANTED };
+    len += rec_encode(&auth, &last, &buf[len]);
+
+    for (int64_t t = HOST_TEST_T0_US + 50000; t <= HOST_TEST_T0_US + 1000000; t += 50000) {
+        rec_event_t tick = { .type = REC_TICK, .time_us = t, .tick = { .pot_raw = 4095, .accel_raw = 4095 } };
+        len += rec_encode(&tick, &last, &buf[len]);
+    }
+    return len;
+}
+
+TEST_CASE("replay rides the recorded profile", "[replay]")
+{
+    replay_result_t result;
+
+    dac_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, make_throttle_ride(ride, NULL), log_dac, NULL, &result));
+    TEST_ASSERT_EQUAL_UINT8(255, dac_log[dac_count - 1]);
+    TEST_ASSERT_EQUAL_UINT8(motor_profile_default.assist_max, motor_control_assist_level());
+
+    // The rider's tag: a narrower assist range and no throttle
+    const rec_profile_t profile = {
+        .assist_min = 10, .assist_max = 50, .speed_limit_kmh = 25, .throttle = false,
+        .kp = KP, .ki = KI, .kd = KD,
+    };
+    dac_count = 0;
+    TEST_ASSERT_EQUAL(ESP_OK, replay_run(ride, make_throttle_ride(ride, &profile), log_dac, NULL, &result));
+    TEST_ASSERT_EQUAL_UINT8(0, dac_log[dac_count - 1]);
+    TEST_ASSERT_EQUAL_UINT8(50, motor_control_assist_level());
+}
+
+TEST_CASE("replay rejects foreign and truncated streams", "[replay]")
+{
+    replay_result_t result;
+    size_t len = host_test_make_ride(ride, sizeof(ride), 2);
+
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, replay_run((const uint8_t *)"nope", 4, NULL, NULL, &result));
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_SIZE, replay_run(ride, len - 1, NULL, NULL, &result));
+}
@@ -0,0 +1,156 @@
+#include <string.h>
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "rider_profile.h"
+#include "rc522_crc.h"
+#include "rfid_mock.h"
+#include "sdkconfig.h"
+#include "host_test.h"
+
+#define TAG_PAGES            45 					// NTAG213
+
+static const uint8_t rider_uid[7] = { 0x04, 0x11, 0x22, 0x33, 0x44, 0x55, 0x66 };
+static const uint8_t other_uid[4] = { 0x12, 0x34, 0x56, 0x78 };
+
+static const motor_profile_t commuter = {
+    .assist_min = 20,
+    .assist_max = 60,
+    .speed_limit_kmh = 25,
+    .throttle = false,
+    .kp = 0.8,
+    .ki = 0.125,
+    .kd = 0.02,
+};
+
+typedef struct {
+    const motor_profile_t *profile;
+    rider_profile_source_t source;
+} tap_t;
+
+// Loads the profile from the tag callback, as main.c does
+static void on_tag(const uint8_t *uid, size_t uid_len, void *ctx) {
+    tap_t *tap = ctx;
+    tap->profile = rider_profile_load(uid, uid_len, &tap->source);
+}
+
+static void start_with_tag(tap_t *tap, uint8_t *memory, const motor_profile_t *profile) {
+    memset(memory, 0, TAG_PAGES * 4);
+    if (profile) TEST_ASSERT_EQUAL(ESP_OK, rider_profile_encode(profile, &memory[CONFIG_PROFILE_NTAG_PAGE * 4]));
+    rider_profile_clear_cache();
+    rfid_init(on_tag, tap);
+    rfid_mock_set_pages(memory, TAG_PAGES * 4);
+}
+
+static void assert_profile_equal(const motor_profile_t *expected, const motor_profile_t *actual) {
+    TEST_ASSERT_EQUAL_UINT8(expected->assist_min, actual->assist_min);
+    TEST_ASSERT_EQUAL_UINT8(expected->assist_max, actual->assist_max);
+    TEST_ASSERT_EQUAL_UINT8(expected->speed_limit_kmh, actual->speed_limit_kmh);
+    TEST_ASSERT_EQUAL(expected->throttle, actual->throttle);
+    TEST_ASSERT_TRUE(expected->kp == actual->kp);
+    TEST_ASSERT_TRUE(expected->ki == actual->ki);
+    TEST_ASSERT_TRUE(expected->kd == actual->kd);
+}
+
+TEST_CASE("profile record round trips and keeps the default gains exact", "[profile]")
+{
+    uint8_t record[RIDER_PROFILE_SIZE];
+    motor_profile_t decoded;
+
+    TEST_ASSERT_EQUAL(ESP_OK, rider_profile_encode(&commuter, record));
+    TEST_ASSERT_EQUAL(ESP_OK, rider_profile_decode(record, &decoded));
+    assert_profile_equal(&commuter, &decoded);
+
+    // So a tag holding the defaults rides exactly like no profile
+    TEST_ASSERT_EQUAL(ESP_OK, rider_profile_encode(&motor_profile_default, record));
+    TEST_ASSERT_EQUAL(ESP_OK, rider_profile_decode(record, &decoded));
+    assert_profile_equal(&motor_profile_default, &decoded);
+
+    motor_profile_t bad = commuter;
+    bad.assist_max = 101;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, rider_profile_encode(&bad, record));
+    bad = commuter;
+    bad.kp = 70.0;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_ARG, rider_profile_encode(&bad, record));
+}
+
+TEST_CASE("profile record is rejected on a bad CRC, magic or version", "[profile]")
+{
+    uint8_t record[RIDER_PROFILE_SIZE];
+    motor_profile_t decoded;
+
+    // Every single-bit error is caught
+    TEST_ASSERT_EQUAL(ESP_OK, rider_profile_encode(&commuter, record));
+    for (int bit = 0; bit < RIDER_PROFILE_SIZE * 8; bit++) {
+        record[bit / 8] ^= 1 << (bit % 8);
+        TEST_ASSERT_EQUAL(ESP_ERR_INVALID_CRC, rider_profile_decode(record, &decoded));
+        record[bit / 8] ^= 1 << (bit % 8);
+    }
+
+    // Blank memory
+    memset(record, 0, sizeof(record));
+    TEST_ASSERT_NOT_EQUAL(ESP_OK, rider_profile_decode(record, &decoded));
+
+    // A newer layout with a valid CRC
+    TEST_ASSERT_EQUAL(ESP_OK, rider_profile_encode(&commuter, record));
+    record[2] = RIDER_PROFILE_VERSION + 1;
+    uint16_t crc = rc522_crc_a(record, RIDER_PROFILE_SIZE - 2);
+    record[14] = crc & 0xFF;
+    record[15] = crc >> 8;
+    TEST_ASSERT_EQUAL(ESP_ERR_INVALID_VERSION, rider_profile_decode(record, &decoded));
+}
+
+TEST_CASE("profile is read once per tag and cached for re-taps", "[profile]")
+{
+    uint8_t memory[TAG_PAGES * 4];
+    tap_t tap = { 0 };
+    start_with_tag(&tap, memory, &commuter);
+
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_READ, tap.source);
+    assert_profile_equal(&commuter, tap.profile);
+    TEST_ASSERT_EQUAL(1, rfid_mock_page_reads());
+
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_CACHED, tap.source);
+    assert_profile_equal(&commuter, tap.profile);
+    TEST_ASSERT_EQUAL(1, rfid_mock_page_reads());
+
+    // Another tag is another read, and the oldest entry makes room
+    for (int i = 0; i < CONFIG_PROFILE_CACHE_SIZE; i++) {
+        uint8_t uid[4] = { 0x20, 0, 0, (uint8_t)i };
+        rfid_mock_present(uid, sizeof(uid));
+    }
+    TEST_ASSERT_EQUAL(1 + CONFIG_PROFILE_CACHE_SIZE, rfid_mock_page_reads());
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_READ, tap.source);
+}
+
+TEST_CASE("tags without a profile ride the defaults", "[profile]")
+{
+    uint8_t memory[TAG_PAGES * 4];
+    tap_t tap = { 0 };
+
+    // Blank NTAG: read once, remembered as having none
+    start_with_tag(&tap, memory, NULL);
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_NONE, tap.source);
+    TEST_ASSERT_EQUAL_PTR(&motor_profile_default, tap.profile);
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(1, rfid_mock_page_reads());
+
+    // No FAST_READ (MIFARE Classic): nothing to read
+    rfid_mock_set_pages(NULL, 0);
+    rfid_mock_present(other_uid, sizeof(other_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_NONE, tap.source);
+    TEST_ASSERT_EQUAL(1, rfid_mock_page_reads());
+
+    // A failed read is tried again at the next tap
+    start_with_tag(&tap, memory, &commuter);
+    rfid_mock_set_pages(memory, CONFIG_PROFILE_NTAG_PAGE * 4);
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_NONE, tap.source);
+    rfid_mock_set_pages(memory, sizeof(memory));
+    rfid_mock_present(rider_uid, sizeof(rider_uid));
+    TEST_ASSERT_EQUAL(RIDER_PROFILE_READ, tap.source);
+    TEST_ASSERT_EQUAL(2, rfid_mock_page_reads());
+}
@@ -0,0 +1,59 @@
+#include "unity.h"
+#include "sdkconfig.h"
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "motor_control.h"
+#include "supervisor.h"
+#include "host_test.h"
+
+#define DEADLINE_US          (CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS * 1000)
+
+TEST_CASE("supervisor waits for the first heartbeat", "[supervisor]")
+{
+    hal_mock_time_advance_us(10 * DEADLINE_US);
+    TEST_ASSERT_FALSE(supervisor_poll(hal_time_us()));
+    TEST_ASSERT_FALSE(supervisor_tripped());
+}
+
+TEST_CASE("supervisor cuts the motor after the deadline", "[supervisor]")
+{
+    set_motor_output(0.8f);
+    supervisor_feed();
+    TEST_ASSERT_EQUAL_UINT8(204, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    TEST_ASSERT_FALSE(supervisor_poll(HOST_TEST_T0_US + DEADLINE_US));
+    TEST_ASSERT_TRUE(supervisor_poll(HOST_TEST_T0_US + DEADLINE_US + 1));
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    supervisor_diag_t diag;
+    supervisor_get_diag(&diag);
+    TEST_ASSERT_EQUAL_UINT32(1, diag.trips);
+    TEST_ASSERT_EQUAL_UINT32(DEADLINE_US + 1, diag.last_stall_us);
+
+    // Only one trip is counted per fault
+    TEST_ASSERT_FALSE(supervisor_poll(HOST_TEST_T0_US + 2 * DEADLINE_US));
+}
+
+TEST_CASE("supervisor latch holds the motor off until cleared", "[supervisor]")
+{
+    supervisor_feed();
+    supervisor_poll(HOST_TEST_T0_US + DEADLINE_US + 1);
+
+    // The control loop comes back with full throttle
+    hal_mock_ain_set(ACCELERATOR_ADC, 4095);
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(0, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+
+    supervisor_clear();
+    motor_control_tick();
+    TEST_ASSERT_EQUAL_UINT8(255, hal_mock_aout_get(DAC_OUTPUT_CHANNEL));
+}
+
+TEST_CASE("regular ticks keep the supervisor quiet", "[supervisor]")
+{
+    for (int i = 0; i < 100; i++) {
+        motor_control_tick();
+        hal_mock_time_advance_us(PID_UPDATE_MS * 1000);
+        TEST_ASSERT_FALSE(supervisor_poll(hal_time_us()));
+    }
+}
@@ -0,0 +1,53 @@
+#include "unity.h"
+#include "ebike_hal_mock.h"
+#include "board_pins.h"
+#include "turn_signals.h"
+#include "host_test.h"
+
+TEST_CASE("turn signal latches and times out", "[turn]")
+{
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, 1);
+    check_turn_signals();
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, 0);
+    TEST_ASSERT_EQUAL(TURN_RIGHT, turn_signals_state());
+
+    hal_mock_time_advance_us(TURN_SIGNAL_TIMEOUT * 1000);
+    check_turn_signals();
+    TEST_ASSERT_EQUAL(TURN_RIGHT, turn_signals_state());
+
+    hal_mock_time_advance_us(1);
+    check_turn_signals();
+    TEST_ASSERT_EQUAL(TURN_NONE, turn_signals_state());
+}
+
+TEST_CASE("opposite turn signal takes over", "[turn]")
+{
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, 1);
+    check_turn_signals();
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, 0);
+    hal_mock_dio_set(TURN_SIGNAL_LEFT, 1);
+    check_turn_signals();
+    TEST_ASSERT_EQUAL(TURN_LEFT, turn_signals_state());
+}
+
+TEST_CASE("blind spot LED only on the signalled side", "[turn]")
+{
+    hal_mock_dio_set(RCWL_RIGHT_GPIO, 1);
+    check_blind_spots();
+    TEST_ASSERT_EQUAL(0, hal_mock_dio_get(BLIND_SPOT_LED_GPIO));
+
+    hal_mock_dio_set(TURN_SIGNAL_LEFT, 1);
+    check_turn_signals();
+    check_blind_spots();
+    TEST_ASSERT_EQUAL(0, hal_mock_dio_get(BLIND_SPOT_LED_GPIO));
+
+    hal_mock_dio_set(TURN_SIGNAL_LEFT, 0);
+    hal_mock_dio_set(TURN_SIGNAL_RIGHT, 1);
+    check_turn_signals();
+    check_blind_spots();
+    TEST_ASSERT_EQUAL(1, hal_mock_dio_get(BLIND_SPOT_LED_GPIO));
+
+    hal_mock_dio_set(RCWL_RIGHT_GPIO, 0);
+    check_blind_spots();
+    TEST_ASSERT_EQUAL(0, hal_mock_dio_get(BLIND_SPOT_LED_GPIO));
+}
@@ -0,0 +1,210 @@
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "ebike_hal.h"
+#include "board_pins.h"
+#include "display.h"
+
+// SPI time per frame of the riding screen on the firmware wiring.
+// "legacy" replays the old per-byte sender (one polling transaction per
+// byte, DC toggled for each), the others are display_update() on the
+// framebuffer driver, for a full screen and for a typical speed/battery
+// change that only flushes the dirty spans. With
+// CONFIG_LCD_NOKIA5110_ASYNC_FLUSH (default) those are the times the UI
+// is held; the bus time is printed from the driver stats. "numbers"
+// compares snprintf + write_string with lcd_nokia5110_write_fixed() for
+// the speed readout, framebuffer only.
+// "init" comes first: lcd_nokia5110_init() runs on the other core and
+// must return within INIT_TIMEOUT_MS. With the async flush its lock is
+// taken while the panel is set up; an uninitialized spinlock hangs there.
+
+#define FRAMES               200
+#define NUMBERS              2000
+#define INIT_TIMEOUT_MS      1000
+#if CONFIG_LCD_NOKIA5110_ASYNC_FLUSH
+#define FLUSH_MODE           "async"
+#else
+#define FLUSH_MODE           "inline"
+#endif
+
+static hal_spi_dev_t legacy_spi;
+
+static void legacy_send(uint8_t data, int dc) {
+    hal_dio_write(DISPLAY_DC_PIN, dc);
+    hal_spi_write(legacy_spi, &data, 1);
+}
+
+static void legacy_print(const char *str) {
+    while (*str) legacy_send(*str++, 1);
+}
+
+// Same byte stream as the old display_update()
+static void legacy_frame(void) {
+    for (int i = 0; i < 504; i++) legacy_send(0x00, 1);
+    legacy_send(0x80, 0);
+    legacy_send(0x40, 0);
+    legacy_print("Batt: 36.5V");
+    legacy_send(0x80, 0);
+    legacy_send(0x41, 0);
+    legacy_print("Speed: 24.8km/h");
+    legacy_send(0x80, 0);
+    legacy_send(0x42, 0);
+    legacy_print("Assist: 55%");
+    legacy_send(0x80, 0);
+    legacy_send(0x43, 0);
+    legacy_print("<-");
+}
+
+static void print_result(const char *name, int64_t total_us) {
+    printf("%-7s %6.0f us/frame\n", name, (double)total_us / FRAMES);
+}
+
+static void bench_legacy(void) {
+    hal_dio_config((1ULL << DISPLAY_RST_PIN) | (1ULL << DISPLAY_DC_PIN), HAL_PIN_OUTPUT, HAL_EDGE_NONE);
+    hal_dio_write(DISPLAY_RST_PIN, 1);
+
+    hal_spi_bus_config_t buscfg = {
+        .host = DISPLAY_SPI_HOST,
+        .pin_mosi = DISPLAY_DIN_PIN,
+        .pin_miso = -1,
+        .pin_sclk = DISPLAY_CLK_PIN,
+    };
+    hal_spi_dev_config_t devcfg = {
+        .host = DISPLAY_SPI_HOST,
+        .pin_cs = DISPLAY_CE_PIN,
+        .clock_hz = 4 * 1000 * 1000,
+        .queue_size = 1,
+    };
+    ESP_ERROR_CHECK(hal_spi_bus_init(&buscfg));
+    ESP_ERROR_CHECK(hal_spi_add_device(&devcfg, &legacy_spi));
+
+    int64_t start = hal_time_us();
+    for (int i = 0; i < FRAMES; i++) legacy_frame();
+    print_result("legacy", hal_time_us() - start);
+
+    hal_spi_remove_device(legacy_spi);
+    hal_spi_bus_free(DISPLAY_SPI_HOST);
+}
+
+static void print_stats(void) {
+    // Let the flush task finish the last frame
+    vTaskDelay(pdMS_TO_TICKS(20));
+
+    lcd_nokia5110_stats_t stats;
+    display_get_stats(&stats);
+    printf("        flush %lu us (max %lu), %.1f transactions and %.1f bytes per frame\n",
+           (unsigned long)stats.last_flush_us, (unsigned long)stats.max_flush_us,
+           (double)stats.transactions / stats.frames, (double)stats.bytes / stats.frames);
+    // With the async flush the caller only pays for the copy to the front
+    // buffer; the bus time is spent in the flush task, blocked on the DMA
+    printf("        update() %lu us (max %lu) in the caller, %lu us saved per frame\n",
+           (unsigned long)stats.last_update_us, (unsigned long)stats.max_update_us,
+           stats.last_flush_us > stats.last_update_us
+               ? (unsigned long)(stats.last_flush_us - stats.last_update_us) : 0UL);
+}
+
+static const lcd_nokia5110_config_t lcd_config = {
+    .pin_sclk = DISPLAY_CLK_PIN,
+    .pin_din = DISPLAY_DIN_PIN,
+    .pin_dc = DISPLAY_DC_PIN,
+    .pin_cs = DISPLAY_CE_PIN,
+    .pin_rst = DISPLAY_RST_PIN,
+    .spi_host = DISPLAY_SPI_HOST,
+};
+
+typedef struct {
+    TaskHandle_t waiter;
+    esp_err_t ret;
+    int64_t elapsed_us;
+} init_check_t;
+
+static void init_task(void *arg) {
+    init_check_t *check = arg;
+    lcd_nokia5110_t lcd;
+    int64_t start = hal_time_us();
+    check->ret = lcd_nokia5110_init(&lcd_config, &lcd);
+    check->elapsed_us = hal_time_us() - start;
+    if (check->ret == ESP_OK) lcd_nokia5110_deinit(lcd);
+    xTaskNotifyGive(check->waiter);
+    vTaskDelete(NULL);
+}
+
+static bool check_init(void) {
+    static init_check_t check; 					// Outlives a hung init task
+    check.waiter = xTaskGetCurrentTaskHandle();
+    xTaskCreatePinnedToCore(init_task, "lcd_init", 4096, &check, 1, NULL, 1);
+    if (!ulTaskNotifyTake(pdTRUE, pdMS_TO_TICKS(INIT_TIMEOUT_MS))) {
+        printf("init    FAILED: lcd_nokia5110_init() did not return in %d ms\n", INIT_TIMEOUT_MS);
+        return false;
+    }
+    printf("init    %s in %lld us, " FLUSH_MODE " flush\n", esp_err_to_name(check.ret), check.elapsed_us);
+    return check.ret == ESP_OK;
+}
+
+static void bench_numbers(void) {
+    lcd_nokia5110_t lcd;
+    ESP_ERROR_CHECK(lcd_nokia5110_init(&lcd_config, &lcd));
+
+    char text[8];
+    int64_t start = hal_time_us();
+    for (int i = 0; i < NUMBERS; i++) {
+        snprintf(text, sizeof(text), "%5.1f", (float)(i % 1000) / 10.0f);
+        lcd_nokia5110_set_cursor(lcd, 24, 1);
+        lcd_nokia5110_write_string(lcd, text);
+    }
+    int64_t snprintf_us = hal_time_us() - start;
+
+    start = hal_time_us();
+    for (int i = 0; i < NUMBERS; i++) {
+        lcd_nokia5110_set_cursor(lcd, 24, 1);
+        lcd_nokia5110_write_fixed(lcd, i % 1000, 1, 5, 0);
+    }
+    int64_t fixed_us = hal_time_us() - start;
+
+    printf("numbers snprintf %.2f us, write_fixed %.2f us per value\n",
+           (double)snprintf_us / NUMBERS, (double)fixed_us / NUMBERS);
+    lcd_nokia5110_deinit(lcd);
+}
+
+static void bench_framebuffer(void) {
+    display_init();
+
+    display_status_t status = {
+        .battery_voltage = 36.5f,
+        .speed_kmh = 24.8f,
+        .assist_level = 55,
+        .turn = TURN_LEFT,
+    };
+
+    // Whole riding screen drawn over the idle screen
+    int64_t total = 0;
+    for (int i = 0; i < FRAMES; i++) {
+        display_show_waiting();
+        int64_t start = hal_time_us();
+        display_update(&status);
+        total += hal_time_us() - start;
+    }
+    print_result("full", total);
+    print_stats();
+
+    // Typical riding: only the speed and battery digits change
+    display_clear_stats();
+    int64_t start = hal_time_us();
+    for (int i = 0; i < FRAMES; i++) {
+        status.speed_kmh = 20.0f + (float)(i % 100) / 10.0f;
+        status.battery_voltage = 36.5f - (float)(i / 50) / 10.0f;
+        display_update(&status);
+    }
+    print_result("partial", hal_time_us() - start);
+    print_stats();
+}
+
+void app_main(void) {
+    printf("PCD8544 frame benchmark, %d frames at 4 MHz\n", FRAMES);
+    if (!check_init()) return;
+    bench_legacy();
+    bench_numbers();
+    bench_framebuffer();
+}
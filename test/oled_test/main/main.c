@@ -1,72 +1,81 @@
-#include "driver/i2c.h"
-#include "esp_lcd_panel_vendor.h"
-#include "esp_lcd_panel_ops.h"
-#include "esp_lcd_panel_io.h"
-#include "esp_log.h"
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "ebike_hal.h"
+#include "lcd_nokia5110.h"
 
-#define I2C_MASTER_SCL_IO 22
-#define I2C_MASTER_SDA_IO 21
-#define I2C_MASTER_NUM I2C_NUM_0
-#define I2C_MASTER_FREQ_HZ 100000
+// Frame time of the SSD1306 backend of the display driver at 400 kHz and
+// 1 MHz: a full frame (1 KB in one window) and a riding-screen style
+// update where only the speed and battery digits change. The times are
+// the flush task's bus time from the driver stats.
 
-#define OLED_WIDTH 128
-#define OLED_HEIGHT 64
+#define OLED_SDA_PIN         21
+#define OLED_SCL_PIN         22
+#define OLED_I2C_PORT        0
+#define OLED_ADDR            0x3D
+#define OLED_HEIGHT          64
+#define FRAMES               100
 
-static const char *TAG = "oled_test";
+static void print_stats(lcd_nokia5110_t lcd, const char *name, int frames) {
+    // Let the flush task finish the last frame
+    vTaskDelay(pdMS_TO_TICKS(50));
 
-void app_main(void)
-{
-    // 1. Configurar bus I2C
-    i2c_config_t i2c_conf = {
-        .mode = I2C_MODE_MASTER,
-        .sda_io_num = I2C_MASTER_SDA_IO,
-        .scl_io_num = I2C_MASTER_SCL_IO,
-        .sda_pullup_en = GPIO_PULLUP_ENABLE,
-        .scl_pullup_en = GPIO_PULLUP_ENABLE,
-        .master.clk_speed = I2C_MASTER_FREQ_HZ
-    };
-    i2c_param_config(I2C_MASTER_NUM, &i2c_conf);
-    i2c_driver_install(I2C_MASTER_NUM, I2C_MODE_MASTER, 0, 0, 0);
+    lcd_nokia5110_stats_t stats;
+    lcd_nokia5110_get_stats(lcd, &stats);
+    printf("%-8s flush %lu us (max %lu), %.1f transactions and %.1f bytes per frame, %lu flushes for %d frames\n",
+           name, (unsigned long)stats.last_flush_us, (unsigned long)stats.max_flush_us,
+           (double)stats.transactions / frames, (double)stats.bytes / frames,
+           (unsigned long)stats.flushes, frames);
+    lcd_nokia5110_clear_stats(lcd);
+}
 
-    // 2. Crear IO handle para el panel SSD1306 por I2C
-    esp_lcd_panel_io_handle_t io_handle = NULL;
-    esp_lcd_panel_io_i2c_config_t io_config = {
-        .dev_addr = 0x3D,  // Dirección típica del SSD1306
-        .control_phase_bytes = 1,
-        .lcd_cmd_bits = 8,
-        .lcd_param_bits = 8,
-        .dc_bit_offset = 6,
-        .flags = {
-            .dc_low_on_data = false,  // El bit DC en alto indica data
-        },
+static void bench(int clock_hz) {
+    lcd_nokia5110_config_t config = {
+        .panel = LCD_NOKIA5110_PANEL_SSD1306,
+        .i2c_port = OLED_I2C_PORT,
+        .pin_sda = OLED_SDA_PIN,
+        .pin_scl = OLED_SCL_PIN,
+        .i2c_addr = OLED_ADDR,
+        .height = OLED_HEIGHT,
+        .clock_hz = clock_hz,
+        .contrast = 0x3F,
     };
-    ESP_ERROR_CHECK(esp_lcd_new_panel_io_i2c(I2C_MASTER_NUM, &io_config, &io_handle));
+    lcd_nokia5110_t lcd;
+    ESP_ERROR_CHECK(lcd_nokia5110_init(&config, &lcd));
+    printf("SSD1306 at %d kHz\n", clock_hz / 1000);
 
-    // 3. Configuración específica para el SSD1306
-    esp_lcd_panel_ssd1306_config_t vendor_config = {
-        .height = OLED_HEIGHT
-    };
+    lcd_nokia5110_set_cursor(lcd, 0, 0);
+    lcd_nokia5110_write_string(lcd, "Batt:");
+    lcd_nokia5110_set_cursor(lcd, 54, 2);
+    lcd_nokia5110_write_string(lcd, "km/h");
+    lcd_nokia5110_draw_rect(lcd, 0, 40, 128, 8, false, true);
+    lcd_nokia5110_update(lcd);
+    lcd_nokia5110_clear_stats(lcd);
 
-    // 4. Configuración general del panel
-    esp_lcd_panel_dev_config_t panel_config = {
-        .reset_gpio_num = -1,
-        .color_space = ESP_LCD_COLOR_SPACE_MONOCHROME,
-        .bits_per_pixel = 1,
-        .vendor_config = &vendor_config
-    };
+    // Whole panel, one frame at a time so none coalesce
+    for (int i = 0; i < FRAMES; i++) {
+        lcd_nokia5110_invalidate(lcd);
+        lcd_nokia5110_update(lcd);
+        vTaskDelay(pdMS_TO_TICKS(40));
+    }
+    print_stats(lcd, "full", FRAMES);
 
-    // 5. Crear panel
-    esp_lcd_panel_handle_t panel_handle = NULL;
-    esp_err_t err = esp_lcd_new_panel_ssd1306(io_handle, &panel_config, &panel_handle);
-    if (err != ESP_OK) {
-        ESP_LOGE(TAG, "Failed to create panel: %s", esp_err_to_name(err));
-        return;
+    // Speed and battery digits only
+    for (int i = 0; i < FRAMES; i++) {
+        lcd_nokia5110_set_cursor(lcd, 0, 1);
+        lcd_nokia5110_write_fixed_font(lcd, &font_digits_2x, 200 + i % 100, 1, 4, 0);
+        lcd_nokia5110_set_cursor(lcd, 30, 0);
+        lcd_nokia5110_write_fixed(lcd, 365 - i / 20, 1, 5, 0);
+        lcd_nokia5110_update(lcd);
+        vTaskDelay(pdMS_TO_TICKS(10));
     }
+    print_stats(lcd, "partial", FRAMES);
+
+    lcd_nokia5110_deinit(lcd);
+}
 
-    // 6. Inicializar y mostrar algo
-    esp_lcd_panel_reset(panel_handle);
-    esp_lcd_panel_init(panel_handle);
-    esp_lcd_panel_disp_on_off(panel_handle, true);
-    esp_lcd_panel_draw_bitmap(panel_handle, 0, 0, OLED_WIDTH, OLED_HEIGHT, NULL);  // Limpia pantalla
-    vTaskDelay(pdMS_TO_TICKS(100));
+void app_main(void) {
+    printf("SSD1306 frame benchmark, %d frames\n", FRAMES);
+    bench(400 * 1000);
+    bench(1000 * 1000);
 }
@@ -1,24 +0,0 @@
-/*
- * SPDX-FileCopyrightText: 2015-2021 Espressif Systems (Shanghai) CO LTD
- *
- * SPDX-License-Identifier: Apache-2.0
- */
-
-#pragma once
-
-#include "stdint.h"
-/* Exported types ------------------------------------------------------------*/
-/* Exported constants --------------------------------------------------------*/
-/* Exported macro ------------------------------------------------------------*/
-/* Exported functions ------------------------------------------------------- */
-extern const uint8_t c_chFont1206[95][12];
-extern const uint8_t c_chFont1608[95][16];
-extern const uint8_t c_chFont1612[11][32];
-extern const uint8_t c_chFont3216[11][64];
-extern const uint8_t c_chBmp4016[96];
-extern const uint8_t c_chSingal816[16];
-extern const uint8_t c_chMsg816[16];
-extern const uint8_t c_chBluetooth88[8];
-extern const uint8_t c_chBat816[16];
-extern const uint8_t c_chGPRS88[8];
-extern const uint8_t c_chAlarm88[8];
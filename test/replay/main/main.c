@@ -0,0 +1,69 @@
+#include <stdio.h>
+#include <stdlib.h>
+#include <inttypes.h>
+#include <time.h>
+#include "replay.h"
+
+// Replay a recording extracted with firmware/tools/rec_extract.py:
+//
+//   REPLAY_FILE=ride.bin ./build/replay.elf
+//
+// REPLAY_EXPECT=<digest> fails the run when the outputs differ, and
+// REPLAY_TICKS=1 prints time, inputs and DAC value of every tick.
+
+#define MAX_RECORDING        (16 * 1024 * 1024)
+
+static void print_tick(const rec_event_t *tick, uint8_t dac_value, void *ctx) {
+    printf("%" PRId64 ",%u,%u,%u,%u\n", tick->time_us, tick->tick.pot_raw,
+           tick->tick.accel_raw, tick->tick.levels, dac_value);
+}
+
+static int64_t now_ns(void) {
+    struct timespec ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return (int64_t)ts.tv_sec * 1000000000 + ts.tv_nsec;
+}
+
+void app_main(void) {
+    const char *path = getenv("REPLAY_FILE");
+    const char *expect = getenv("REPLAY_EXPECT");
+    const char *ticks = getenv("REPLAY_TICKS");
+
+    FILE *f = path ? fopen(path, "rb") : stdin;
+    if (!f) {
+        printf("replay: cannot open %s\n", path);
+        exit(2);
+    }
+    uint8_t *stream = malloc(MAX_RECORDING);
+    size_t len = stream ? fread(stream, 1, MAX_RECORDING, f) : 0;
+    if (path) fclose(f);
+
+    bool print = ticks && ticks[0] == '1';
+    if (print) printf("time_us,pot,accel,levels,dac\n");
+
+    replay_result_t result;
+    int64_t start = now_ns();
+    esp_err_t ret = replay_run(stream, len, print ? print_tick : NULL, NULL, &result);
+    int64_t elapsed_ns = now_ns() - start;
+    free(stream);
+
+    if (ret == ESP_ERR_INVALID_ARG) {
+        printf("replay: not a ride recording\n");
+        exit(2);
+    }
+
+    double span_s = (double)(result.end_us - result.start_us) / 1e6;
+    double wall_s = (double)elapsed_ns / 1e9;
+    printf("replay: %.3f s of ride, %" PRIu32 " ticks, %" PRIu32 " edges, %" PRIu32 " tags, "
+           "%" PRIu32 " frames, %" PRIu32 " records lost%s\n",
+           span_s, result.ticks, result.edges, result.tags, result.frames, result.lost,
+           ret == ESP_ERR_INVALID_SIZE ? ", truncated" : "");
+    printf("replay: %.3f ms wall, %.0fx real time\n", wall_s * 1e3, wall_s > 0 ? span_s / wall_s : 0.0);
+    printf("replay: digest %08" PRIx32 "\n", result.digest);
+
+    if (expect && strtoul(expect, NULL, 16) != result.digest) {
+        printf("replay: digest mismatch, expected %s\n", expect);
+        exit(1);
+    }
+    exit(0);
+}
@@ -1,55 +1,303 @@
-#include <esp_log.h>
+#include <stdio.h>
+#include <string.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "sdkconfig.h"
+#include "esp_attr.h"
+#include "ebike_hal.h"
+#include "hal_spi_prof.h"
+#include "board_pins.h"
 #include "rc522.h"
 #include "driver/rc522_spi.h"
 #include "rc522_picc.h"
+#include "picc/rc522_mifare.h"
+#include "picc/rc522_nxp.h"
 
-static const char *TAG = "rc522-basic-example";
-
-#define RC522_SPI_BUS_GPIO_MISO    (19)
-#define RC522_SPI_BUS_GPIO_MOSI    (23)
-#define RC522_SPI_BUS_GPIO_SCLK    (18)
-#define RC522_SPI_SCANNER_GPIO_SDA (5)
-#define RC522_SCANNER_GPIO_RST     (4) // soft-reset
-
-static rc522_spi_config_t driver_config = {
-    .host_id = SPI3_HOST,
-    .bus_config = &(spi_bus_config_t){
-        .miso_io_num = RC522_SPI_BUS_GPIO_MISO,
-        .mosi_io_num = RC522_SPI_BUS_GPIO_MOSI,
-        .sclk_io_num = RC522_SPI_BUS_GPIO_SCLK,
-    },
-    .dev_config = {
-        .spics_io_num = RC522_SPI_SCANNER_GPIO_SDA,
-    },
-    .rst_io_num = RC522_SCANNER_GPIO_RST,
-};
+// RC522 cost and latency on the firmware wiring, on the shared SPI bus as
+// in rfid_esp32.c.
+// "poll" runs the scanner for POLL_MS with no card in the field under
+// each scan policy: a REQA every 50 ms with the antenna always on, polling
+// the interrupt request registers or waiting for the IRQ pin; presence
+// checks with the antenna off in between, at two detection latencies; and
+// paused. It reports SPI transactions and bytes per second, the RF-on duty
+// cycle and the scanner task's CPU load, and the transactions per
+// presence check.
+// Then present a card a few times: a MIFARE Classic with the transport
+// key, or an NTAG/Ultralight. "event" is how much later the esp_event
+// handler sees a PICC state change than the direct callback, which runs
+// right after the change; the firmware (rfid_esp32.c) uses the callback.
+// "select" is the time from the READY to the ACTIVE state event, which
+// is the anticollision/select cascade. On an NTAG21x, "profile" is the
+// FAST_READ of the rider profile record (profile component, pages 4-7)
+// and "tap" the REQA-to-profile time the firmware logs as PROFILE_READY,
+// less the authorization. "read" is
+// one 16-byte block: MIFARE READ after authentication, or an NXP READ of 4
+// pages. On a MIFARE Classic 1K or 4K, "example" reads the whole card the
+// way examples/memory_dump does (sector descriptors, the parsed trailer and
+// each block, without the printing) and "bulk" with
+// rc522_mifare_read_blocks(). SPI figures come from the SPI profiler
+// (CONFIG_EBIKE_HAL_SPI_PROFILE, on by default), CPU time from the
+// FreeRTOS run time stats (sdkconfig.defaults).
+// Build with CONFIG_RC522_SPI_BURST=n (sdkconfig.defaults) for the
+// per-byte reads and per-access bus holds of the old driver.
+
+#define POLL_MS              5000
+#define READS                100
+#if CONFIG_RC522_SPI_BURST
+#define DRIVER               "burst"
+#else
+#define DRIVER               "per-byte"
+#endif
+#define BLOCK                4 						// First data block outside the manufacturer sector
+#define PROFILE_PAGE         4 						// CONFIG_PROFILE_NTAG_PAGE default
 
 static rc522_driver_handle_t driver;
 static rc522_handle_t scanner;
+static hal_spi_client_t bus_client;
+static hal_spi_prof_t *spi_prof;
+static uint8_t card[4096]; 						// MIFARE Classic 4K
+static int64_t ready_us;
+static int64_t callback_us;
+static int64_t event_delay_us;
+static int events;
 
-static void on_picc_state_changed(void *arg, esp_event_base_t base, int32_t event_id, void *data)
-{
-    rc522_picc_state_changed_event_t *event = (rc522_picc_state_changed_event_t *)data;
-    rc522_picc_t *picc = event->picc;
+static void IRAM_ATTR rc522_spi_pre_cb(spi_transaction_t *t) {
+    HAL_SPI_PROF_BEGIN(spi_prof);
+}
+
+static void IRAM_ATTR rc522_spi_post_cb(spi_transaction_t *t) {
+    HAL_SPI_PROF_END(spi_prof, t->length / 8, true);
+}
+
+static esp_err_t rc522_bus_acquire(void *ctx) {
+    return hal_spi_acquire(bus_client);
+}
+
+static void rc522_bus_release(void *ctx) {
+    hal_spi_release(bus_client);
+}
+
+static void print_result(const char *name, int64_t total_us, int ops) {
+    hal_spi_prof_stats_t stats = { 0 };
+    hal_spi_prof_get_stats(&stats, 1, NULL);
+    printf("%-7s %7.0f us, %5.1f transactions, %5.1f bytes, %6.0f us on the bus per op\n", name,
+           (double)total_us / ops, (double)stats.transactions / ops, (double)stats.bytes / ops,
+           (double)stats.busy_us / ops);
+}
+
+static esp_err_t read_block(rc522_picc_t *picc, uint8_t *buffer) {
+    if (rc522_mifare_type_is_classic_compatible(picc->type)) {
+        return rc522_mifare_read(scanner, picc, BLOCK, buffer);
+    }
+    return rc522_nxp_read(scanner, picc, BLOCK, buffer);
+}
 
-    if (picc->state == RC522_PICC_STATE_ACTIVE) {
-        rc522_picc_print(picc);
+static void bench_profile(rc522_picc_t *picc, int64_t select_us) {
+    uint8_t record[16];
+    rc522_nxp_fast_read_data_t data = { .bytes = record, .buffer_size = sizeof(record) };
+
+    if (!rc522_nxp_type_has_fast_read(picc->type)) return;
+    hal_spi_prof_clear();
+    int64_t start = hal_time_us();
+    esp_err_t ret = rc522_nxp_fast_read(scanner, picc, PROFILE_PAGE, PROFILE_PAGE + 3, &data);
+    int64_t read_us = hal_time_us() - start;
+    if (ret != ESP_OK) {
+        printf("profile FAST_READ failed\n");
+        return;
+    }
+    print_result("profile", read_us, 1);
+    printf("tap     %7.0f us from the REQA to the profile\n", (double)(select_us + read_us));
+}
+
+static void bench_read(rc522_picc_t *picc) {
+    uint8_t buffer[RC522_MIFARE_BLOCK_SIZE];
+    bool classic = rc522_mifare_type_is_classic_compatible(picc->type);
+
+    if (classic) {
+        rc522_mifare_key_t key = {
+            .value = { RC522_MIFARE_KEY_VALUE_DEFAULT },
+        };
+        if (rc522_mifare_auth(scanner, picc, BLOCK, &key) != ESP_OK) {
+            printf("read    auth failed, not a transport key?\n");
+            return;
+        }
     }
-    else if (picc->state == RC522_PICC_STATE_IDLE && event->old_state >= RC522_PICC_STATE_ACTIVE) {
-        ESP_LOGI(TAG, "Card has been removed");
+
+    hal_spi_prof_clear();
+    int64_t start = hal_time_us();
+    for (int i = 0; i < READS; i++) {
+        if (read_block(picc, buffer) != ESP_OK) {
+            printf("read    failed after %d blocks\n", i);
+            break;
+        }
     }
+    print_result("read", hal_time_us() - start, READS);
+
+    if (classic) rc522_mifare_deauth(scanner, picc);
 }
 
-void app_main()
-{
-    rc522_spi_create(&driver_config, &driver);
-    rc522_driver_install(driver);
+static esp_err_t read_card_example(rc522_picc_t *picc, const rc522_mifare_key_t *key, uint8_t sectors) {
+    for (uint8_t index = 0; index < sectors; index++) {
+        rc522_mifare_sector_desc_t sector;
+        rc522_mifare_sector_block_t trailer, block;
+        esp_err_t ret = rc522_mifare_get_sector_desc(index, &sector);
+        if (ret == ESP_OK) ret = rc522_mifare_auth_sector(scanner, picc, &sector, key);
+        if (ret == ESP_OK) ret = rc522_mifare_read_sector_trailer_block(scanner, picc, &sector, &trailer);
+        for (uint8_t offset = 0; ret == ESP_OK && offset < sector.number_of_blocks - 1; offset++) {
+            ret = rc522_mifare_read_sector_block(scanner, picc, &sector, &trailer, offset, &block);
+        }
+        if (ret != ESP_OK) return ret;
+    }
+    return ESP_OK;
+}
+
+static void bench_card(rc522_picc_t *picc) {
+    rc522_mifare_key_t key = {
+        .value = { RC522_MIFARE_KEY_VALUE_DEFAULT },
+    };
+    rc522_mifare_desc_t mifare;
+
+    if (rc522_mifare_get_desc(picc, &mifare) != ESP_OK) return;
 
+    hal_spi_prof_clear();
+    int64_t start = hal_time_us();
+    esp_err_t ret = read_card_example(picc, &key, mifare.number_of_sectors);
+    int64_t example_us = hal_time_us() - start;
+    if (ret != ESP_OK) {
+        printf("example read failed, not a transport key?\n");
+        return;
+    }
+    print_result("example", example_us, 1);
+
+    hal_spi_prof_clear();
+    start = hal_time_us();
+    ret = rc522_mifare_read_blocks(scanner, picc, &key, 0, mifare.number_of_blocks, card);
+    int64_t bulk_us = hal_time_us() - start;
+    rc522_mifare_deauth(scanner, picc);
+    if (ret != ESP_OK) {
+        printf("bulk    read failed\n");
+        return;
+    }
+    print_result("bulk", bulk_us, 1);
+    printf("card    %d sectors, %d bytes: %.0f bytes/s bulk, %.2fx the example\n", mifare.number_of_sectors,
+           mifare.number_of_blocks * RC522_MIFARE_BLOCK_SIZE,
+           mifare.number_of_blocks * RC522_MIFARE_BLOCK_SIZE * 1e6 / bulk_us, (double)example_us / bulk_us);
+}
+
+// Both run in the scanner task, the callback first
+static void on_picc_state_callback(const rc522_picc_t *picc, rc522_picc_state_t old_state, void *ctx) {
+    callback_us = hal_time_us();
+}
+
+static void on_picc_state_changed(void *arg, esp_event_base_t base, int32_t event_id, void *data) {
+    rc522_picc_state_changed_event_t *event = (rc522_picc_state_changed_event_t *)data;
+    rc522_picc_t *picc = event->picc;
+
+    event_delay_us += hal_time_us() - callback_us;
+    events++;
+
+    if (picc->state == RC522_PICC_STATE_READY) {
+        // The select follows right after this event
+        hal_spi_prof_clear();
+        ready_us = hal_time_us();
+    } else if (picc->state == RC522_PICC_STATE_ACTIVE && ready_us) {
+        int64_t select_us = hal_time_us() - ready_us;
+        print_result("select", select_us, 1);
+        ready_us = 0;
+        bench_profile(picc, select_us);
+        printf("event   %5.1f us after the direct callback, %d state changes\n",
+               (double)event_delay_us / events, events);
+        bench_read(picc);
+        if (rc522_mifare_type_is_classic_compatible(picc->type)) bench_card(picc);
+        printf("Remove the card and present it again\n");
+    }
+}
+
+static void scanner_start(gpio_num_t irq_io_num, uint16_t detect_interval_ms) {
     rc522_config_t scanner_config = {
         .driver = driver,
+        .irq_io_num = irq_io_num,
+        .detect_interval_ms = detect_interval_ms,
     };
-
-    rc522_create(&scanner_config, &scanner);
+    ESP_ERROR_CHECK(rc522_create(&scanner_config, &scanner));
+    rc522_set_picc_state_callback(scanner, on_picc_state_callback, NULL);
     rc522_register_events(scanner, RC522_EVENT_PICC_STATE_CHANGED, on_picc_state_changed, NULL);
-    rc522_start(scanner);
+    ESP_ERROR_CHECK(rc522_start(scanner));
+}
+
+static uint32_t scanner_run_time(void) {
+    TaskStatus_t status;
+    vTaskGetInfo(xTaskGetHandle("rc522_polling_task"), &status, pdFALSE, eRunning);
+    return status.ulRunTimeCounter;
+}
+
+static void bench_poll(const char *name, gpio_num_t irq_io_num, uint16_t detect_interval_ms, bool paused) {
+    scanner_start(irq_io_num, detect_interval_ms);
+    if (paused) rc522_pause(scanner);
+    vTaskDelay(pdMS_TO_TICKS(200));
+
+    rc522_stats_t before, after;
+    hal_spi_prof_clear();
+    rc522_get_stats(scanner, &before);
+    uint32_t run_time = scanner_run_time();
+    vTaskDelay(pdMS_TO_TICKS(POLL_MS));
+    run_time = scanner_run_time() - run_time;
+    rc522_get_stats(scanner, &after);
+
+    hal_spi_prof_stats_t stats = { 0 };
+    hal_spi_prof_get_stats(&stats, 1, NULL);
+    double seconds = POLL_MS / 1000.0;
+    uint32_t checks = after.presence_checks - before.presence_checks;
+    printf("poll    %-11s %6.1f transactions/s %7.0f bytes/s, RF on %5.1f%%, CPU %4.1f%%, "
+           "%5.1f checks/s, %5.1f transactions per check\n", name,
+           stats.transactions / seconds, stats.bytes / seconds,
+           100.0 * (after.rf_on_us - before.rf_on_us) / (POLL_MS * 1000.0),
+           100.0 * run_time / (POLL_MS * 1000.0), checks / seconds,
+           checks ? (double)stats.transactions / checks : 0.0);
+
+    ESP_ERROR_CHECK(rc522_destroy(scanner));
+}
+
+void app_main(void) {
+    printf("RC522 latency, %s driver at 5 MHz, %d block reads per tap\n", DRIVER, READS);
+
+    hal_spi_bus_config_t bus_config = {
+        .host = RC522_SPI_HOST,
+        .pin_mosi = RC522_MOSI_GPIO,
+        .pin_miso = RC522_MISO_GPIO,
+        .pin_sclk = RC522_SCLK_GPIO,
+    };
+    ESP_ERROR_CHECK(hal_spi_bus_init(&bus_config));
+
+    hal_spi_client_config_t client_config = {
+        .host = RC522_SPI_HOST,
+        .name = "rc522",
+        .priority = RC522_SPI_PRIORITY,
+    };
+    ESP_ERROR_CHECK(hal_spi_add_client(&client_config, &bus_client));
+    spi_prof = HAL_SPI_PROF_REGISTER("rc522");
+
+    rc522_spi_config_t driver_config = {
+        .host_id = RC522_SPI_HOST,
+        .dev_config = {
+            .spics_io_num = RC522_SDA_GPIO,
+            .pre_cb = rc522_spi_pre_cb,
+            .post_cb = rc522_spi_post_cb,
+        },
+        .rst_io_num = RC522_RST_GPIO,
+        .bus_acquire = rc522_bus_acquire,
+        .bus_release = rc522_bus_release,
+    };
+    ESP_ERROR_CHECK(rc522_spi_create(&driver_config, &driver));
+    ESP_ERROR_CHECK(rc522_driver_install(driver));
+
+    printf("Keep cards away for %d s\n", 5 * POLL_MS / 1000);
+    bench_poll("polling", GPIO_NUM_NC, 0, false);
+    bench_poll("irq", RC522_IRQ_GPIO, 0, false);
+    bench_poll("detect 100", RC522_IRQ_GPIO, 100, false);
+    bench_poll("detect 250", RC522_IRQ_GPIO, 250, false);
+    bench_poll("paused", RC522_IRQ_GPIO, 100, true);
+
+    scanner_start(RC522_IRQ_GPIO, 100);
+    printf("Present a card\n");
 }
@@ -1,11 +0,0 @@
-#pragma once
-
-#include "rc522_types.h"
-
-#ifdef __cplusplus
-extern "C" {
-#endif
-
-#ifdef __cplusplus
-}
-#endif
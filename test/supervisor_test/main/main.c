@@ -0,0 +1,74 @@
+#include <stdio.h>
+#include "freertos/FreeRTOS.h"
+#include "freertos/task.h"
+#include "nvs_flash.h"
+#include "ebike_hal.h"
+#include "motor_control.h"
+#include "turn_signals.h"
+#include "supervisor.h"
+#include "dlog.h"
+
+// Fault injection for the control supervisor.
+// The control task runs on core 1 as in the firmware; each trial stalls it
+// with supervisor_inject_stall() and measures heartbeat-to-cut time.
+
+#define TRIALS               20
+#define STALL_MS             (CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS + 100)
+#define LIMIT_US             (CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS * 1000 + CONFIG_EBIKE_SUPERVISOR_CHECK_US)
+
+void app_main(void) {
+    nvs_flash_init();
+    dlog_init();
+    turn_signals_init();
+    motor_control_init();
+    supervisor_init();
+    supervisor_clear_diag();
+    xTaskCreatePinnedToCore(motor_control_task, "motor_control", 4096, NULL, 5, NULL, 1);
+
+    printf("Supervisor fault injection: deadline %d ms, check every %d us, %d trials of %d ms stalls\n",
+           CONFIG_EBIKE_SUPERVISOR_DEADLINE_MS, CONFIG_EBIKE_SUPERVISOR_CHECK_US, TRIALS, STALL_MS);
+    vTaskDelay(pdMS_TO_TICKS(500));
+
+    uint32_t min_us = UINT32_MAX, max_us = 0;
+    uint64_t sum_us = 0;
+    int missed = 0;
+
+    for (int i = 0; i < TRIALS; i++) {
+        supervisor_inject_stall(STALL_MS);
+
+        // The cut has to happen while the control task is still stuck
+        int64_t start = hal_time_us();
+        while (!supervisor_tripped() && hal_time_us() - start < 2 * STALL_MS * 1000) {
+            vTaskDelay(1);
+        }
+
+        supervisor_diag_t diag;
+        supervisor_get_diag(&diag);
+        if (!supervisor_tripped() || diag.trips != (uint32_t)i + 1 - missed) {
+            printf("trial %d: no cut\n", i);
+            missed++;
+        } else {
+            uint32_t us = diag.last_stall_us;
+            printf("trial %d: stall to cut %lu us\n", i, (unsigned long)us);
+            if (us < min_us) min_us = us;
+            if (us > max_us) max_us = us;
+            sum_us += us;
+        }
+
+        // Let the stall end and the loop run again before releasing the latch
+        vTaskDelay(pdMS_TO_TICKS(STALL_MS + 200));
+        supervisor_clear();
+        vTaskDelay(pdMS_TO_TICKS(300));
+        if (supervisor_tripped()) {
+            printf("trial %d: spurious trip after clear\n", i);
+        }
+    }
+
+    int cut = TRIALS - missed;
+    if (cut) {
+        printf("Stall to cut: min %lu us, avg %lu us, max %lu us (limit %d us)\n",
+               (unsigned long)min_us, (unsigned long)(sum_us / cut), (unsigned long)max_us, LIMIT_US);
+    }
+    printf("%s: %d/%d stalls cut within the deadline bound\n",
+           (missed == 0 && max_us <= LIMIT_US) ? "PASS" : "FAIL", cut, TRIALS);
+}